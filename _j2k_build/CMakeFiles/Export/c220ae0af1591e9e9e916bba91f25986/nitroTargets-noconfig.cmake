@@ -0,0 +1,289 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "jpeg" for configuration ""
+set_property(TARGET jpeg APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(jpeg PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libjpeg.a"
+  )
+
+list(APPEND _cmake_import_check_targets jpeg )
+list(APPEND _cmake_import_check_files_for_jpeg "${_IMPORT_PREFIX}/lib/libjpeg.a" )
+
+# Import target "pcre2" for configuration ""
+set_property(TARGET pcre2 APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(pcre2 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libpcre2-8.a"
+  )
+
+list(APPEND _cmake_import_check_targets pcre2 )
+list(APPEND _cmake_import_check_files_for_pcre2 "${_IMPORT_PREFIX}/lib/libpcre2-8.a" )
+
+# Import target "hdf5-c++" for configuration ""
+set_property(TARGET hdf5-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libhdf5-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets hdf5-c++ )
+list(APPEND _cmake_import_check_files_for_hdf5-c++ "${_IMPORT_PREFIX}/lib/libhdf5-c++.a" )
+
+# Import target "except-c++" for configuration ""
+set_property(TARGET except-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(except-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libexcept-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets except-c++ )
+list(APPEND _cmake_import_check_files_for_except-c++ "${_IMPORT_PREFIX}/lib/libexcept-c++.a" )
+
+# Import target "sys-c++" for configuration ""
+set_property(TARGET sys-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(sys-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libsys-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets sys-c++ )
+list(APPEND _cmake_import_check_files_for_sys-c++ "${_IMPORT_PREFIX}/lib/libsys-c++.a" )
+
+# Import target "str-c++" for configuration ""
+set_property(TARGET str-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(str-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libstr-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets str-c++ )
+list(APPEND _cmake_import_check_files_for_str-c++ "${_IMPORT_PREFIX}/lib/libstr-c++.a" )
+
+# Import target "mem-c++" for configuration ""
+set_property(TARGET mem-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mem-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmem-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets mem-c++ )
+list(APPEND _cmake_import_check_files_for_mem-c++ "${_IMPORT_PREFIX}/lib/libmem-c++.a" )
+
+# Import target "re-c++" for configuration ""
+set_property(TARGET re-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(re-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libre-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets re-c++ )
+list(APPEND _cmake_import_check_files_for_re-c++ "${_IMPORT_PREFIX}/lib/libre-c++.a" )
+
+# Import target "io-c++" for configuration ""
+set_property(TARGET io-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(io-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libio-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets io-c++ )
+list(APPEND _cmake_import_check_files_for_io-c++ "${_IMPORT_PREFIX}/lib/libio-c++.a" )
+
+# Import target "sio.lite-c++" for configuration ""
+set_property(TARGET sio.lite-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(sio.lite-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libsio.lite-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets sio.lite-c++ )
+list(APPEND _cmake_import_check_files_for_sio.lite-c++ "${_IMPORT_PREFIX}/lib/libsio.lite-c++.a" )
+
+# Import target "cli-c++" for configuration ""
+set_property(TARGET cli-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(cli-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libcli-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets cli-c++ )
+list(APPEND _cmake_import_check_files_for_cli-c++ "${_IMPORT_PREFIX}/lib/libcli-c++.a" )
+
+# Import target "dbi-c++" for configuration ""
+set_property(TARGET dbi-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(dbi-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libdbi-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets dbi-c++ )
+list(APPEND _cmake_import_check_files_for_dbi-c++ "${_IMPORT_PREFIX}/lib/libdbi-c++.a" )
+
+# Import target "types-c++" for configuration ""
+set_property(TARGET types-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(types-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libtypes-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets types-c++ )
+list(APPEND _cmake_import_check_files_for_types-c++ "${_IMPORT_PREFIX}/lib/libtypes-c++.a" )
+
+# Import target "math-c++" for configuration ""
+set_property(TARGET math-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(math-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmath-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets math-c++ )
+list(APPEND _cmake_import_check_files_for_math-c++ "${_IMPORT_PREFIX}/lib/libmath-c++.a" )
+
+# Import target "mt-c++" for configuration ""
+set_property(TARGET mt-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(mt-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmt-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets mt-c++ )
+list(APPEND _cmake_import_check_files_for_mt-c++ "${_IMPORT_PREFIX}/lib/libmt-c++.a" )
+
+# Import target "logging-c++" for configuration ""
+set_property(TARGET logging-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(logging-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/liblogging-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets logging-c++ )
+list(APPEND _cmake_import_check_files_for_logging-c++ "${_IMPORT_PREFIX}/lib/liblogging-c++.a" )
+
+# Import target "net-c++" for configuration ""
+set_property(TARGET net-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(net-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libnet-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets net-c++ )
+list(APPEND _cmake_import_check_files_for_net-c++ "${_IMPORT_PREFIX}/lib/libnet-c++.a" )
+
+# Import target "net.ssl-c++" for configuration ""
+set_property(TARGET net.ssl-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(net.ssl-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libnet.ssl-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets net.ssl-c++ )
+list(APPEND _cmake_import_check_files_for_net.ssl-c++ "${_IMPORT_PREFIX}/lib/libnet.ssl-c++.a" )
+
+# Import target "plugin-c++" for configuration ""
+set_property(TARGET plugin-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(plugin-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libplugin-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets plugin-c++ )
+list(APPEND _cmake_import_check_files_for_plugin-c++ "${_IMPORT_PREFIX}/lib/libplugin-c++.a" )
+
+# Import target "tiff-c++" for configuration ""
+set_property(TARGET tiff-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(tiff-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libtiff-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets tiff-c++ )
+list(APPEND _cmake_import_check_files_for_tiff-c++ "${_IMPORT_PREFIX}/lib/libtiff-c++.a" )
+
+# Import target "polygon-c++" for configuration ""
+set_property(TARGET polygon-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(polygon-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libpolygon-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets polygon-c++ )
+list(APPEND _cmake_import_check_files_for_polygon-c++ "${_IMPORT_PREFIX}/lib/libpolygon-c++.a" )
+
+# Import target "math.linear-c++" for configuration ""
+set_property(TARGET math.linear-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(math.linear-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libmath.linear-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets math.linear-c++ )
+list(APPEND _cmake_import_check_files_for_math.linear-c++ "${_IMPORT_PREFIX}/lib/libmath.linear-c++.a" )
+
+# Import target "hdf5.lite-c++" for configuration ""
+set_property(TARGET hdf5.lite-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(hdf5.lite-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libhdf5.lite-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets hdf5.lite-c++ )
+list(APPEND _cmake_import_check_files_for_hdf5.lite-c++ "${_IMPORT_PREFIX}/lib/libhdf5.lite-c++.a" )
+
+# Import target "nrt-c" for configuration ""
+set_property(TARGET nrt-c APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(nrt-c PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libnrt-c.a"
+  )
+
+list(APPEND _cmake_import_check_targets nrt-c )
+list(APPEND _cmake_import_check_files_for_nrt-c "${_IMPORT_PREFIX}/lib/libnrt-c.a" )
+
+# Import target "nitf-c" for configuration ""
+set_property(TARGET nitf-c APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(nitf-c PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libnitf-c.a"
+  )
+
+list(APPEND _cmake_import_check_targets nitf-c )
+list(APPEND _cmake_import_check_files_for_nitf-c "${_IMPORT_PREFIX}/lib/libnitf-c.a" )
+
+# Import target "cgm-c" for configuration ""
+set_property(TARGET cgm-c APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(cgm-c PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libcgm-c.a"
+  )
+
+list(APPEND _cmake_import_check_targets cgm-c )
+list(APPEND _cmake_import_check_files_for_cgm-c "${_IMPORT_PREFIX}/lib/libcgm-c.a" )
+
+# Import target "j2k-c" for configuration ""
+set_property(TARGET j2k-c APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(j2k-c PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libj2k-c.a"
+  )
+
+list(APPEND _cmake_import_check_targets j2k-c )
+list(APPEND _cmake_import_check_files_for_j2k-c "${_IMPORT_PREFIX}/lib/libj2k-c.a" )
+
+# Import target "nitf-c++" for configuration ""
+set_property(TARGET nitf-c++ APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(nitf-c++ PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libnitf-c++.a"
+  )
+
+list(APPEND _cmake_import_check_targets nitf-c++ )
+list(APPEND _cmake_import_check_files_for_nitf-c++ "${_IMPORT_PREFIX}/lib/libnitf-c++.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,402 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS openjpeg jpeg pcre2 hdf5-c++ highfive-c++ TestCase config-c++ coda_oss-c++ avx-c++ except-c++ sys-c++ str-c++ mem-c++ re-c++ io-c++ sio.lite-c++ cli-c++ dbi-c++ types-c++ units-c++ math-c++ mt-c++ logging-c++ net-c++ net.ssl-c++ plugin-c++ tiff-c++ polygon-c++ math.linear-c++ math.poly-c++ hdf5.lite-c++ gsl-c++ std-c++ nrt-c nitf-c cgm-c j2k-c nitf-c++)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target openjpeg
+add_library(openjpeg INTERFACE IMPORTED)
+
+set_target_properties(openjpeg PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/tmp/opj/include"
+  INTERFACE_LINK_LIBRARIES "/tmp/opj/lib/libopenjpeg.so"
+)
+
+# Create imported target jpeg
+add_library(jpeg STATIC IMPORTED)
+
+set_target_properties(jpeg PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+# Create imported target pcre2
+add_library(pcre2 STATIC IMPORTED)
+
+set_target_properties(pcre2 PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "PCRE2_CODE_UNIT_WIDTH=8"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+# Create imported target hdf5-c++
+add_library(hdf5-c++ STATIC IMPORTED)
+
+set_target_properties(hdf5-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+# Create imported target highfive-c++
+add_library(highfive-c++ INTERFACE IMPORTED)
+
+set_target_properties(highfive-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++;sys-c++;hdf5-c++"
+)
+
+# Create imported target TestCase
+add_library(TestCase INTERFACE IMPORTED)
+
+set_target_properties(TestCase PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;str-c++"
+)
+
+# Create imported target config-c++
+add_library(config-c++ INTERFACE IMPORTED)
+
+set_target_properties(config-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include;${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "Threads::Threads;dl"
+)
+
+# Create imported target coda_oss-c++
+add_library(coda_oss-c++ INTERFACE IMPORTED)
+
+set_target_properties(coda_oss-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++;gsl-c++"
+)
+
+# Create imported target avx-c++
+add_library(avx-c++ INTERFACE IMPORTED)
+
+set_target_properties(avx-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++"
+)
+
+# Create imported target except-c++
+add_library(except-c++ STATIC IMPORTED)
+
+set_target_properties(except-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++"
+)
+
+# Create imported target sys-c++
+add_library(sys-c++ STATIC IMPORTED)
+
+set_target_properties(sys-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++;except-c++;str-c++;gsl-c++;coda_oss-c++"
+)
+
+# Create imported target str-c++
+add_library(str-c++ STATIC IMPORTED)
+
+set_target_properties(str-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "types-c++;except-c++;coda_oss-c++"
+)
+
+# Create imported target mem-c++
+add_library(mem-c++ STATIC IMPORTED)
+
+set_target_properties(mem-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;gsl-c++;coda_oss-c++;std-c++"
+)
+
+# Create imported target re-c++
+add_library(re-c++ STATIC IMPORTED)
+
+set_target_properties(re-c++ PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "PCRE2_STATIC"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;pcre2"
+)
+
+# Create imported target io-c++
+add_library(io-c++ STATIC IMPORTED)
+
+set_target_properties(io-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;mem-c++;std-c++;gsl-c++"
+)
+
+# Create imported target sio.lite-c++
+add_library(sio.lite-c++ STATIC IMPORTED)
+
+set_target_properties(sio.lite-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;io-c++;types-c++"
+)
+
+# Create imported target cli-c++
+add_library(cli-c++ STATIC IMPORTED)
+
+set_target_properties(cli-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;mem-c++"
+)
+
+# Create imported target dbi-c++
+add_library(dbi-c++ STATIC IMPORTED)
+
+set_target_properties(dbi-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "io-c++"
+)
+
+# Create imported target types-c++
+add_library(types-c++ STATIC IMPORTED)
+
+set_target_properties(types-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "coda_oss-c++;config-c++;gsl-c++"
+)
+
+# Create imported target units-c++
+add_library(units-c++ INTERFACE IMPORTED)
+
+set_target_properties(units-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "math-c++"
+)
+
+# Create imported target math-c++
+add_library(math-c++ STATIC IMPORTED)
+
+set_target_properties(math-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "except-c++;str-c++;sys-c++;types-c++;coda_oss-c++"
+)
+
+# Create imported target mt-c++
+add_library(mt-c++ STATIC IMPORTED)
+
+set_target_properties(mt-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;except-c++;math-c++;mem-c++;types-c++;std-c++"
+)
+
+# Create imported target logging-c++
+add_library(logging-c++ STATIC IMPORTED)
+
+set_target_properties(logging-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "io-c++;mt-c++;std-c++;sys-c++"
+)
+
+# Create imported target net-c++
+add_library(net-c++ STATIC IMPORTED)
+
+set_target_properties(net-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "logging-c++;re-c++;io-c++;mem-c++;CURL::libcurl"
+)
+
+# Create imported target net.ssl-c++
+add_library(net.ssl-c++ STATIC IMPORTED)
+
+set_target_properties(net.ssl-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "net-c++;OpenSSL::SSL;OpenSSL::Crypto"
+)
+
+# Create imported target plugin-c++
+add_library(plugin-c++ STATIC IMPORTED)
+
+set_target_properties(plugin-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "io-c++;mem-c++;logging-c++"
+)
+
+# Create imported target tiff-c++
+add_library(tiff-c++ STATIC IMPORTED)
+
+set_target_properties(tiff-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "mt-c++;io-c++"
+)
+
+# Create imported target polygon-c++
+add_library(polygon-c++ STATIC IMPORTED)
+
+set_target_properties(polygon-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;mem-c++;types-c++;math-c++;except-c++"
+)
+
+# Create imported target math.linear-c++
+add_library(math.linear-c++ STATIC IMPORTED)
+
+set_target_properties(math.linear-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;mem-c++;types-c++;gsl-c++"
+)
+
+# Create imported target math.poly-c++
+add_library(math.poly-c++ INTERFACE IMPORTED)
+
+set_target_properties(math.poly-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++;math.linear-c++"
+)
+
+# Create imported target hdf5.lite-c++
+add_library(hdf5.lite-c++ STATIC IMPORTED)
+
+set_target_properties(hdf5.lite-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "highfive-c++;hdf5-c++;except-c++;types-c++;io-c++;coda_oss-c++"
+)
+
+# Create imported target gsl-c++
+add_library(gsl-c++ INTERFACE IMPORTED)
+
+set_target_properties(gsl-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "config-c++"
+)
+
+# Create imported target std-c++
+add_library(std-c++ INTERFACE IMPORTED)
+
+set_target_properties(std-c++ PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "sys-c++"
+)
+
+# Create imported target nrt-c
+add_library(nrt-c STATIC IMPORTED)
+
+set_target_properties(nrt-c PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "dl;config-c++"
+)
+
+# Create imported target nitf-c
+add_library(nitf-c STATIC IMPORTED)
+
+set_target_properties(nitf-c PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "nrt-c"
+)
+
+# Create imported target cgm-c
+add_library(cgm-c STATIC IMPORTED)
+
+set_target_properties(cgm-c PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "nitf-c"
+)
+
+# Create imported target j2k-c
+add_library(j2k-c STATIC IMPORTED)
+
+set_target_properties(j2k-c PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "openjpeg;nitf-c;nrt-c"
+)
+
+# Create imported target nitf-c++
+add_library(nitf-c++ STATIC IMPORTED)
+
+set_target_properties(nitf-c++ PROPERTIES
+  INTERFACE_COMPILE_FEATURES "cxx_inheriting_constructors"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "nitf-c;j2k-c;except-c++;sio.lite-c++;io-c++;mt-c++;sys-c++;str-c++;gsl-c++;std-c++"
+)
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/nitroTargets-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
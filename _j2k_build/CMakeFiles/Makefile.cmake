@@ -0,0 +1,577 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "_deps/nitro_pcre2-src/config-cmake.h.in"
+  "_deps/nitro_pcre2-src/src/pcre2.h.generic"
+  "_deps/nitro_pcre2-src/src/pcre2_chartables.c.dist"
+  "/root/repo/cmake/nitroConfig.cmake.in"
+  "/root/repo/externals/coda-oss/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake"
+  "/root/repo/externals/coda-oss/cmake/CodaFindSystemDependencies.cmake"
+  "/root/repo/externals/coda-oss/modules/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/avx/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/cli/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/coda_oss/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/config/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/config/include/config/coda_oss_config.h.in"
+  "/root/repo/externals/coda-oss/modules/c++/dbi/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/except/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/gsl/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/hdf5.lite/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/logging/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/mt/include/mt/mt_config.h.cmake.in"
+  "/root/repo/externals/coda-oss/modules/c++/net.ssl/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/net.ssl/include/net/ssl/net.ssl_config.h.cmake.in"
+  "/root/repo/externals/coda-oss/modules/c++/net/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/net/include/net/net_config.h.cmake.in"
+  "/root/repo/externals/coda-oss/modules/c++/numpyutils/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/plugin/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/polygon/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/re/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/re/include/re/re_config.h.cmake.in"
+  "/root/repo/externals/coda-oss/modules/c++/sio.lite/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/std/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/str/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/sys/include/sys/sys_config.h.cmake.in"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/unique/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/units/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/xml.lite/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/c++/zip/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/highfive/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/j2k/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/j2k/openjpeg/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/jars/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/jpeg/CMakeLists.txt"
+  "/root/repo/externals/coda-oss/modules/drivers/jpeg/jconfig.h.in"
+  "/root/repo/externals/coda-oss/modules/drivers/pcre/CMakeLists.txt"
+  "/root/repo/modules/CMakeLists.txt"
+  "/root/repo/modules/c++/CMakeLists.txt"
+  "/root/repo/modules/c++/nitf/CMakeLists.txt"
+  "/root/repo/modules/c/CMakeLists.txt"
+  "/root/repo/modules/c/cgm/CMakeLists.txt"
+  "/root/repo/modules/c/j2k/CMakeLists.txt"
+  "/root/repo/modules/c/j2k/include/j2k/j2k_config.h.cmake.in"
+  "/root/repo/modules/c/jpeg/CMakeLists.txt"
+  "/root/repo/modules/c/nitf/CMakeLists.txt"
+  "/root/repo/modules/c/nitf/include/nitf/nitf_config.h.cmake.in"
+  "/root/repo/modules/c/nrt/CMakeLists.txt"
+  "/root/repo/modules/c/nrt/include/nrt/nrt_config.h.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent/CMakeLists.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "nitroConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/j2k/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/j2k/openjpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/jars/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/nitro_jpeg-subbuild/CMakeLists.txt"
+  "_deps/nitro_jpeg-build/jconfig.h"
+  "externals/coda-oss/modules/drivers/jpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/nitro_pcre2-subbuild/CMakeLists.txt"
+  "externals/coda-oss/modules/drivers/pcre/config.h"
+  "externals/coda-oss/modules/drivers/pcre/pcre2.h"
+  "externals/coda-oss/modules/drivers/pcre/pcre2_chartables.c"
+  "externals/coda-oss/modules/drivers/pcre/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/drivers/highfive/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/config/include/config/coda_oss_config.h"
+  "externals/coda-oss/modules/c++/config/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/coda_oss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/avx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/except/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/sys/include/sys/sys_config.h"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/re/include/re/re_config.h"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/zip/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/cli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/dbi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/unique/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/units/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/mt/include/mt/mt_config.h"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/xml.lite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/net/include/net/net_config.h"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/net.ssl/include/net/ssl/net_ssl_config.h"
+  "externals/coda-oss/modules/c++/net.ssl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/tiff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/polygon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/numpyutils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/hdf5.lite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/gsl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "externals/coda-oss/modules/c++/std/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/nrt/include/nrt/nrt_config.h"
+  "modules/c/nrt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/nitf/include/nitf/nitf_config.h"
+  "modules/c/nitf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/cgm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/j2k/include/j2k/j2k_config.h"
+  "modules/c/j2k/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c/jpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c++/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/c++/nitf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "externals/coda-oss/modules/drivers/jpeg/CMakeFiles/jpeg.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/drivers/pcre/CMakeFiles/pcre2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/drivers/highfive/CMakeFiles/highfive_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/drivers/highfive/CMakeFiles/highfive_tests_high_five_base.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/coda_oss/CMakeFiles/coda_oss_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/coda_oss/CMakeFiles/coda_oss_test_bytes.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/coda_oss/CMakeFiles/coda_oss_test_optional.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/avx/CMakeFiles/avx_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/avx/CMakeFiles/avx_test_m256.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/except/CMakeFiles/except_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/except/CMakeFiles/except_Gen2Test.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_CPUTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_DLLTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_DateTimeTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_DirectoryTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ErrTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ExecTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_MemoryTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_MutexTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_OSTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_PathTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_RaiseTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ReadWriteMutexTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ReentrantTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_TestBacktrace.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ThreadFreeTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ThreadTest4.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_ThreadTest5.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_symlink.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_NaN_testing.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_aligned_alloc.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_atomic_counter.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_byte_swap.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_conditionvar.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_datetime.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_os.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sys/CMakeFiles/sys_test_path.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str_ConvertTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str_VersionTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str_test_base_convert.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/str/CMakeFiles/str_test_str.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_ScratchVisualization.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_Span.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_scoped_cloneable_ptr.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_scoped_copyable_ptr.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_scratch_memory.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_shared_ptr.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_unique_ptr.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mem/CMakeFiles/mem_test_vector_pointers.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re_RegexTest2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re_RegexTest3.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re_benchmark_regex.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/re/CMakeFiles/re_test_regex.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_PipeStreamTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_byteStreamTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_byteStreamTest2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_ioTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_ioTest2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_ioTest3.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_ioTest4.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_ioTest5.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_seekTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_serializeTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_stringStreamTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_stringStreamTest2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_test_read_file_contents.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_test_stream_splitter.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_test_streams.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/io/CMakeFiles/io_test_tempfile.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/sio.lite-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/sio.lite_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/sio.lite_FabricateTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/sio.lite_RoundTripTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/sio.lite/CMakeFiles/sio.lite_imdmphdr.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/cli/CMakeFiles/cli-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/cli/CMakeFiles/cli_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/cli/CMakeFiles/cli_test_cli.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/dbi/CMakeFiles/dbi-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/dbi/CMakeFiles/dbi_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/dbi/CMakeFiles/dbi_SQLTest1.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/dbi/CMakeFiles/dbi_SQLTest2.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types_test_complex.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types_test_page_row_col.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types_test_range.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/types/CMakeFiles/types_test_range_list.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/units/CMakeFiles/units_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/units/CMakeFiles/units_test_units.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_complexBenchmark.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_complexMultiplyBenchmark.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_bessel_functions.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_convex_hull.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_is_nan.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_n_choose_k.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_round.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math/CMakeFiles/math_test_sign.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_BasicThreadPoolTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_GenerationThreadPoolTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_MTSingletonTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_SingletonTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_ThreadExceptionTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_ThreadGroupAffinityTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_TwoSingletonsTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_Runnable1DTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_ThreadGroupTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_ThreadPlannerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_balanced_runnable_1d_test.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_test_mt_byte_swap.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/mt/CMakeFiles/mt_work_sharing_balanced_runnable_1d_test.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_BasicLoggerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_FactoryTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_RotatingLoggerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_test_exception_logger.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/logging/CMakeFiles/logging_test_rotating_log.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_NetConnectionClientTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_NetConnectionServerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_TCPClientSpeedTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_TCPClientTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_TCPServerSpeedTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_TCPServerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_UDPClientTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_UDPServerTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net/CMakeFiles/net_URLTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net.ssl/CMakeFiles/net.ssl-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net.ssl/CMakeFiles/net.ssl_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net.ssl/CMakeFiles/net.ssl_SSLTestClient.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/net.ssl/CMakeFiles/net.ssl_SSLTestClientNoURL.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/plugin/CMakeFiles/plugin-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff_DumpHeader.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff_HeaderTest.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/polygon/CMakeFiles/polygon-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/polygon/CMakeFiles/polygon_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/polygon/CMakeFiles/polygon_test_draw_polygon.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/polygon/CMakeFiles/polygon_test_polygon_mask.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_angle.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_cx.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_diag.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_line_2d.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_norm_v.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_norm_vN.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_Vector.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_VectorN.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_eigenvalue.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_inf_equality.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_inverse.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_lin.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.linear/CMakeFiles/math.linear_test_mx.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_OneD_templates.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_fixed.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_inner_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_1d_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_2d_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_fixed_1d_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_fixed_2d_poly.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/math.poly/CMakeFiles/math.poly_test_llsq.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/hdf5.lite/CMakeFiles/hdf5.lite-c++.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/hdf5.lite/CMakeFiles/hdf5.lite_tests.dir/DependInfo.cmake"
+  "externals/coda-oss/modules/c++/hdf5.lite/CMakeFiles/hdf5.lite_test_highfive.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt-c.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_tests.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_arena.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_async_io.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_buffer_adapter.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_cached_adapter.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_core_values.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_list.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_mmap_adapter.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_nrt_byte_swap.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_nrt_datetime.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_tree.dir/DependInfo.cmake"
+  "modules/c/nrt/CMakeFiles/nrt_test_utils.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf-c.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_tests.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_bench_image_io_convert.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_bench_record_arena.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_bench_tre_program.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_create.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_create_nitf.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_field.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_geo_utils.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_header_io.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_image_io.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_image_writer_blocks.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_lazy_tre.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_mem_source.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_moveTREs.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_parallel_write.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_tre_program.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/nitf_test_zero_field.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ACCHZB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ACCPOB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ACCVTB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ACFTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ACFTB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/AIMIDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/AIMIDB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/AIPBCA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ASTORA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/BANDSA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/BANDSB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/BCKGDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/BLOCKA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/BNDPLB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CCINFA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CLCTNA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CLCTNB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CMETAA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSCCGA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSCRNA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSDIDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSEPHA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSEXRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSEXRB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSPROA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSSFAA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/CSSHPA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ENGRDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/EXOPTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/EXPLTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/EXPLTB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/GEOLOB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/GEOPSB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/GRDPSB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/HISTOA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/ICHIPB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/IMASDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/IMGDTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/IMRFCA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/IOMAPA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/J2KLRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/JITCID.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MAPLOB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MATESA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MENSRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MENSRB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MPDSRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MSDIRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MSTGTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MTIRPA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/MTIRPB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/NBLOCA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/OBJCTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/OFFSET.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PATCHA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PATCHB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAEQA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAEVA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAIMB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAIMC.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAPEA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAPEB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAPRC.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIAPRD.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIATGA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIATGB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIXMTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PIXQLA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PLTFMA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PRADAA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PRJPSB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/PTPRAA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/REGPTB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RPC00B.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RPFDES.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RPFHDR.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RPFIMG.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMAPA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMDCA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMECA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMGGA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMGIA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMIDA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMPCA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/RSMPIA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SECTGA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SENSRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SENSRB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SNSPSB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SNSRA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/SOURCB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/STDIDC.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/STEROB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/STREOB.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/TEST_DES.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/TRGTA.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/USE00A.dir/DependInfo.cmake"
+  "modules/c/nitf/CMakeFiles/XML_DATA_CONTENT.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm-c.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm_tests.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm_test_add_cgm.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm_test_extract_cgm.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm_test_read_cgm.dir/DependInfo.cmake"
+  "modules/c/cgm/CMakeFiles/cgm_test_rt_cgm.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k-c.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_tests.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_create.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_header.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_nitf.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_read_region.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_read_tile.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_tile_latency.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/j2k_test_j2k_nitf_partial_block.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/J2KCompress.dir/DependInfo.cmake"
+  "modules/c/j2k/CMakeFiles/J2KDecompress.dir/DependInfo.cmake"
+  "modules/c/jpeg/CMakeFiles/LibjpegDecompress.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf-c++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_bench_handle_registry.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_strip_invisible_segments.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_buffered_read.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_create++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_date.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_date_set.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_des_create++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_direct_block_round_trip.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_extract.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_fh.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_fhdr_clone++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_file_source++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_io.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_list_1.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_list_2.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_read_acftb.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_ref_counts.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_round_trip.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_tre_create.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_writer_4.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_writer_5.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_buffered_reader.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_buffered_writer.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_create_nitf++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_field++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_handle_registry.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_image_blocker.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_image_segment_blank_nm_compression.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_image_segment_computer.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_image_writer.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_nitf_buffer_list.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_parallel_file_writer.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_parallel_write++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_tre_mods.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_tre_mods++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_tre_create++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_j2k_loading++.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_j2k_read_tile.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_j2k_compress_tile.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_j2k_compressed_byte_provider.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_tre_read.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/nitf_test_jpeg_decompress.dir/DependInfo.cmake"
+  "modules/c++/nitf/CMakeFiles/show_nitf++.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nitro_jpeg-populate"
+  "CMakeFiles/nitro_jpeg-populate-complete"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-build"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-configure"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-download"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-install"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-mkdir"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-patch"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-test"
+  "nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/nitro_jpeg-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/nitro_jpeg-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar")
+  message(FATAL_ERROR "File not found: /root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar")
+endif()
+
+if("SHA256" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("898c46bfe9152d51220c6679e905de4df75d2a67dcf315bf80459673ab1eb797" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar'")
+
+file("SHA256" "/root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "898c46bfe9152d51220c6679e905de4df75d2a67dcf315bf80459673ab1eb797")
+  message(FATAL_ERROR "error: SHA256 hash of
+  /root/repo/externals/coda-oss/modules/drivers/jpeg/jpegsrc.v9d.tar
+does not match expected value
+  expected: '898c46bfe9152d51220c6679e905de4df75d2a67dcf315bf80459673ab1eb797'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-src"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-build"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/tmp"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/src"
+  "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_j2k_build/_deps/nitro_jpeg-subbuild/nitro_jpeg-populate-prefix/src/nitro_jpeg-populate-stamp${cfgdir}") # cfgdir has leading slash
+endif()
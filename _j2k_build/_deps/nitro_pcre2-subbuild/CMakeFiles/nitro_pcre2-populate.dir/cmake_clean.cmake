@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nitro_pcre2-populate"
+  "CMakeFiles/nitro_pcre2-populate-complete"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-build"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-configure"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-download"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-install"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-mkdir"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-patch"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-test"
+  "nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/nitro_pcre2-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/nitro_pcre2-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz")
+  message(FATAL_ERROR "File not found: /root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz")
+endif()
+
+if("SHA256" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("6677c66014eba5610b8fbd8196fd4e5904db4116cff1b5a0d14e91121eda4377" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz'")
+
+file("SHA256" "/root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "6677c66014eba5610b8fbd8196fd4e5904db4116cff1b5a0d14e91121eda4377")
+  message(FATAL_ERROR "error: SHA256 hash of
+  /root/repo/externals/coda-oss/modules/drivers/pcre/pcre2-10.22.tar.gz
+does not match expected value
+  expected: '6677c66014eba5610b8fbd8196fd4e5904db4116cff1b5a0d14e91121eda4377'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
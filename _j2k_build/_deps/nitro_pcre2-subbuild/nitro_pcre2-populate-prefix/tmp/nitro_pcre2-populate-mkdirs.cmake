@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-src"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-build"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/tmp"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/src"
+  "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_j2k_build/_deps/nitro_pcre2-subbuild/nitro_pcre2-populate-prefix/src/nitro_pcre2-populate-stamp${cfgdir}") # cfgdir has leading slash
+endif()
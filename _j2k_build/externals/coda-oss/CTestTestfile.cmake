@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss
+# Build directory: /root/repo/_j2k_build/externals/coda-oss
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("modules")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("drivers")
+subdirs("c++")
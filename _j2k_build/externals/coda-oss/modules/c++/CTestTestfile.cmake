@@ -0,0 +1,37 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("config")
+subdirs("coda_oss")
+subdirs("avx")
+subdirs("except")
+subdirs("sys")
+subdirs("str")
+subdirs("mem")
+subdirs("re")
+subdirs("io")
+subdirs("zip")
+subdirs("sio.lite")
+subdirs("cli")
+subdirs("dbi")
+subdirs("types")
+subdirs("unique")
+subdirs("units")
+subdirs("math")
+subdirs("mt")
+subdirs("logging")
+subdirs("xml.lite")
+subdirs("net")
+subdirs("net.ssl")
+subdirs("plugin")
+subdirs("tiff")
+subdirs("polygon")
+subdirs("math.linear")
+subdirs("math.poly")
+subdirs("numpyutils")
+subdirs("hdf5.lite")
+subdirs("gsl")
+subdirs("std")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/avx/unittests/test_m256.cpp" "externals/coda-oss/modules/c++/avx/CMakeFiles/avx_test_m256.dir/unittests/test_m256.cpp.o" "gcc" "externals/coda-oss/modules/c++/avx/CMakeFiles/avx_test_m256.dir/unittests/test_m256.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/avx_test_m256.dir/unittests/test_m256.cpp.o"
+  "CMakeFiles/avx_test_m256.dir/unittests/test_m256.cpp.o.d"
+  "test_m256"
+  "test_m256.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/avx_test_m256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
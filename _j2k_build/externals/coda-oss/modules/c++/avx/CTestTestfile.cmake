@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/avx
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/avx
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(avx_test_m256 "/root/repo/_j2k_build/externals/coda-oss/modules/c++/avx/test_m256")
+set_tests_properties(avx_test_m256 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/avx/CMakeLists.txt;10;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/avx/CMakeLists.txt;0;")
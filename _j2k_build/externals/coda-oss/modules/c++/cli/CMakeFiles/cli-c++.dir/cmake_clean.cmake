@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cli-c++.dir/source/Argument.cpp.o"
+  "CMakeFiles/cli-c++.dir/source/Argument.cpp.o.d"
+  "CMakeFiles/cli-c++.dir/source/ArgumentParser.cpp.o"
+  "CMakeFiles/cli-c++.dir/source/ArgumentParser.cpp.o.d"
+  "libcli-c++.a"
+  "libcli-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cli-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cli_test_cli.dir/unittests/test_cli.cpp.o"
+  "CMakeFiles/cli_test_cli.dir/unittests/test_cli.cpp.o.d"
+  "test_cli"
+  "test_cli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cli_test_cli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/cli
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/cli
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cli_test_cli "/root/repo/_j2k_build/externals/coda-oss/modules/c++/cli/test_cli")
+set_tests_properties(cli_test_cli PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/cli/CMakeLists.txt;8;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/cli/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coda_oss_test_bytes.dir/unittests/test_bytes.cpp.o"
+  "CMakeFiles/coda_oss_test_bytes.dir/unittests/test_bytes.cpp.o.d"
+  "test_bytes"
+  "test_bytes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coda_oss_test_bytes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
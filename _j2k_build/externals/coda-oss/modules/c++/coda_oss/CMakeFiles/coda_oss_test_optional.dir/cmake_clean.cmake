@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/coda_oss_test_optional.dir/unittests/test_optional.cpp.o"
+  "CMakeFiles/coda_oss_test_optional.dir/unittests/test_optional.cpp.o.d"
+  "test_optional"
+  "test_optional.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/coda_oss_test_optional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/coda_oss
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/coda_oss
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(coda_oss_test_bytes "/root/repo/_j2k_build/externals/coda-oss/modules/c++/coda_oss/test_bytes")
+set_tests_properties(coda_oss_test_bytes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/coda_oss/CMakeLists.txt;10;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/coda_oss/CMakeLists.txt;0;")
+add_test(coda_oss_test_optional "/root/repo/_j2k_build/externals/coda-oss/modules/c++/coda_oss/test_optional")
+set_tests_properties(coda_oss_test_optional PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/coda_oss/CMakeLists.txt;10;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/coda_oss/CMakeLists.txt;0;")
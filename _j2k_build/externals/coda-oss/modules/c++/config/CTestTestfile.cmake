@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/config
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/config
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
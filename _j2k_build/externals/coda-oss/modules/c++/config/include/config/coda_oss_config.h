@@ -0,0 +1,21 @@
+/* WARNING! All changes made to this file will be lost! */
+
+#ifndef _CODA_OSS_CONFIG_H_
+#define _CODA_OSS_CONFIG_H_
+
+#ifndef BIGENDIAN
+#define BIGENDIAN 0
+#else
+// some external libraries define the BIGENDIAN macro (e.g. winsock2.h)
+// verify preexisting BIGENDIAN matches the value detected by CMake
+/* #undef CODA_OSS_CHECK_BIGENDIAN */
+#if BIGENDIAN != CODA_OSS_CHECK_BIGENDIAN
+#error "BIGENDIAN macro inconsistent with value determined by build system"
+#endif
+#undef CODA_OSS_CHECK_BIGENDIAN
+#endif
+
+/* still might need these ... for now */
+#define CODA_EXPORT  
+
+#endif /* _CODA_OSS_CONFIG_H_ */
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dbi-c++.dir/source/DatabaseClientFactory.cpp.o"
+  "CMakeFiles/dbi-c++.dir/source/DatabaseClientFactory.cpp.o.d"
+  "CMakeFiles/dbi-c++.dir/source/MySQLConnection.cpp.o"
+  "CMakeFiles/dbi-c++.dir/source/MySQLConnection.cpp.o.d"
+  "CMakeFiles/dbi-c++.dir/source/OracleConnection.cpp.o"
+  "CMakeFiles/dbi-c++.dir/source/OracleConnection.cpp.o.d"
+  "CMakeFiles/dbi-c++.dir/source/PgSQLConnection.cpp.o"
+  "CMakeFiles/dbi-c++.dir/source/PgSQLConnection.cpp.o.d"
+  "libdbi-c++.a"
+  "libdbi-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dbi-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
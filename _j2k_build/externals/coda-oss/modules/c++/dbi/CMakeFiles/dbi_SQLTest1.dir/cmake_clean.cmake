@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dbi_SQLTest1.dir/tests/SQLTest1.cpp.o"
+  "CMakeFiles/dbi_SQLTest1.dir/tests/SQLTest1.cpp.o.d"
+  "SQLTest1"
+  "SQLTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dbi_SQLTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
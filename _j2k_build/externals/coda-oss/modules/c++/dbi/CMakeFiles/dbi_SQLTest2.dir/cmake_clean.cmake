@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dbi_SQLTest2.dir/tests/SQLTest2.cpp.o"
+  "CMakeFiles/dbi_SQLTest2.dir/tests/SQLTest2.cpp.o.d"
+  "SQLTest2"
+  "SQLTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dbi_SQLTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/except/source/Backtrace.cpp" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Backtrace.cpp.o" "gcc" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Backtrace.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/except/source/Context.cpp" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Context.cpp.o" "gcc" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Context.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/except/source/Throwable.cpp" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Throwable.cpp.o" "gcc" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Throwable.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/except/source/Trace.cpp" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Trace.cpp.o" "gcc" "externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/source/Trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
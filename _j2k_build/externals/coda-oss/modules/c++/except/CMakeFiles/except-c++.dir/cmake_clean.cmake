@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/except-c++.dir/source/Backtrace.cpp.o"
+  "CMakeFiles/except-c++.dir/source/Backtrace.cpp.o.d"
+  "CMakeFiles/except-c++.dir/source/Context.cpp.o"
+  "CMakeFiles/except-c++.dir/source/Context.cpp.o.d"
+  "CMakeFiles/except-c++.dir/source/Throwable.cpp.o"
+  "CMakeFiles/except-c++.dir/source/Throwable.cpp.o.d"
+  "CMakeFiles/except-c++.dir/source/Trace.cpp.o"
+  "CMakeFiles/except-c++.dir/source/Trace.cpp.o.d"
+  "libexcept-c++.a"
+  "libexcept-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/except-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
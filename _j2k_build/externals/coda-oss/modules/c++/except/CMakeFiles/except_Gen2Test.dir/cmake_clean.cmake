@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/except_Gen2Test.dir/tests/Gen2Test.cpp.o"
+  "CMakeFiles/except_Gen2Test.dir/tests/Gen2Test.cpp.o.d"
+  "Gen2Test"
+  "Gen2Test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/except_Gen2Test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdf5.lite-c++.dir/source/hdf5.lite.cpp.o"
+  "CMakeFiles/hdf5.lite-c++.dir/source/hdf5.lite.cpp.o.d"
+  "libhdf5.lite-c++.a"
+  "libhdf5.lite-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hdf5.lite-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libhdf5.lite-c++.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdf5.lite_test_highfive.dir/unittests/test_highfive.cpp.o"
+  "CMakeFiles/hdf5.lite_test_highfive.dir/unittests/test_highfive.cpp.o.d"
+  "test_highfive"
+  "test_highfive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hdf5.lite_test_highfive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/hdf5.lite
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/hdf5.lite
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(hdf5.lite_test_highfive "/root/repo/_j2k_build/externals/coda-oss/modules/c++/hdf5.lite/test_highfive")
+set_tests_properties(hdf5.lite_test_highfive PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/hdf5.lite/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/hdf5.lite/CMakeLists.txt;0;")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/io/source/ByteStream.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/ByteStream.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/ByteStream.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/FileInputStreamIOS.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileInputStreamIOS.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileInputStreamIOS.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/FileInputStreamOS.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileInputStreamOS.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileInputStreamOS.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/FileOutputStreamIOS.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileOutputStreamIOS.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileOutputStreamIOS.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/FileOutputStreamOS.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileOutputStreamOS.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileOutputStreamOS.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/FileUtils.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileUtils.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/FileUtils.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/InputStream.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/InputStream.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/InputStream.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/PipeStream.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/PipeStream.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/PipeStream.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/ReadUtils.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/ReadUtils.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/ReadUtils.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/RotatingFileOutputStream.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/RotatingFileOutputStream.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/RotatingFileOutputStream.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/SerializableFile.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/SerializableFile.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/SerializableFile.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/StandardStreams.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StandardStreams.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StandardStreams.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/StreamSplitter.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StreamSplitter.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StreamSplitter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/StringStream.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StringStream.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/StringStream.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/io/source/TempFile.cpp" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/TempFile.cpp.o" "gcc" "externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/source/TempFile.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/CMakeFiles/mem-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
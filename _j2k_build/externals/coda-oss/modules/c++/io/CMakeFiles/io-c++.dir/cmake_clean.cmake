@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io-c++.dir/source/ByteStream.cpp.o"
+  "CMakeFiles/io-c++.dir/source/ByteStream.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/FileInputStreamIOS.cpp.o"
+  "CMakeFiles/io-c++.dir/source/FileInputStreamIOS.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/FileInputStreamOS.cpp.o"
+  "CMakeFiles/io-c++.dir/source/FileInputStreamOS.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/FileOutputStreamIOS.cpp.o"
+  "CMakeFiles/io-c++.dir/source/FileOutputStreamIOS.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/FileOutputStreamOS.cpp.o"
+  "CMakeFiles/io-c++.dir/source/FileOutputStreamOS.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/FileUtils.cpp.o"
+  "CMakeFiles/io-c++.dir/source/FileUtils.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/InputStream.cpp.o"
+  "CMakeFiles/io-c++.dir/source/InputStream.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/PipeStream.cpp.o"
+  "CMakeFiles/io-c++.dir/source/PipeStream.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/ReadUtils.cpp.o"
+  "CMakeFiles/io-c++.dir/source/ReadUtils.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/RotatingFileOutputStream.cpp.o"
+  "CMakeFiles/io-c++.dir/source/RotatingFileOutputStream.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/SerializableFile.cpp.o"
+  "CMakeFiles/io-c++.dir/source/SerializableFile.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/StandardStreams.cpp.o"
+  "CMakeFiles/io-c++.dir/source/StandardStreams.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/StreamSplitter.cpp.o"
+  "CMakeFiles/io-c++.dir/source/StreamSplitter.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/StringStream.cpp.o"
+  "CMakeFiles/io-c++.dir/source/StringStream.cpp.o.d"
+  "CMakeFiles/io-c++.dir/source/TempFile.cpp.o"
+  "CMakeFiles/io-c++.dir/source/TempFile.cpp.o.d"
+  "libio-c++.a"
+  "libio-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
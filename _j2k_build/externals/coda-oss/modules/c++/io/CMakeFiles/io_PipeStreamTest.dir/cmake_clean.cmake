@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_PipeStreamTest.dir/tests/PipeStreamTest.cpp.o"
+  "CMakeFiles/io_PipeStreamTest.dir/tests/PipeStreamTest.cpp.o.d"
+  "PipeStreamTest"
+  "PipeStreamTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_PipeStreamTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_byteStreamTest1.dir/tests/byteStreamTest1.cpp.o"
+  "CMakeFiles/io_byteStreamTest1.dir/tests/byteStreamTest1.cpp.o.d"
+  "byteStreamTest1"
+  "byteStreamTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_byteStreamTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_byteStreamTest2.dir/tests/byteStreamTest2.cpp.o"
+  "CMakeFiles/io_byteStreamTest2.dir/tests/byteStreamTest2.cpp.o.d"
+  "byteStreamTest2"
+  "byteStreamTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_byteStreamTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
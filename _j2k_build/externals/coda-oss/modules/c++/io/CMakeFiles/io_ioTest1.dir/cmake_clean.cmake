@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_ioTest1.dir/tests/ioTest1.cpp.o"
+  "CMakeFiles/io_ioTest1.dir/tests/ioTest1.cpp.o.d"
+  "ioTest1"
+  "ioTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_ioTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_ioTest2.dir/tests/ioTest2.cpp.o"
+  "CMakeFiles/io_ioTest2.dir/tests/ioTest2.cpp.o.d"
+  "ioTest2"
+  "ioTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_ioTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_ioTest3.dir/tests/ioTest3.cpp.o"
+  "CMakeFiles/io_ioTest3.dir/tests/ioTest3.cpp.o.d"
+  "ioTest3"
+  "ioTest3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_ioTest3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_ioTest4.dir/tests/ioTest4.cpp.o"
+  "CMakeFiles/io_ioTest4.dir/tests/ioTest4.cpp.o.d"
+  "ioTest4"
+  "ioTest4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_ioTest4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
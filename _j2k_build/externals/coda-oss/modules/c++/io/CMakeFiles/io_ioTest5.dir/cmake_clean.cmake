@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_ioTest5.dir/tests/ioTest5.cpp.o"
+  "CMakeFiles/io_ioTest5.dir/tests/ioTest5.cpp.o.d"
+  "ioTest5"
+  "ioTest5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_ioTest5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_seekTest1.dir/tests/seekTest1.cpp.o"
+  "CMakeFiles/io_seekTest1.dir/tests/seekTest1.cpp.o.d"
+  "seekTest1"
+  "seekTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_seekTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
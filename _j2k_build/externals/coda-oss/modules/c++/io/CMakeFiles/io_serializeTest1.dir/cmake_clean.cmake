@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_serializeTest1.dir/tests/serializeTest1.cpp.o"
+  "CMakeFiles/io_serializeTest1.dir/tests/serializeTest1.cpp.o.d"
+  "serializeTest1"
+  "serializeTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_serializeTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
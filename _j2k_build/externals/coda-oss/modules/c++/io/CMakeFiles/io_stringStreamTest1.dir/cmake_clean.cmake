@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_stringStreamTest1.dir/tests/stringStreamTest1.cpp.o"
+  "CMakeFiles/io_stringStreamTest1.dir/tests/stringStreamTest1.cpp.o.d"
+  "stringStreamTest1"
+  "stringStreamTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_stringStreamTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
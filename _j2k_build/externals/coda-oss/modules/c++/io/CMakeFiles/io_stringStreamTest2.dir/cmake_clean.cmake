@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_stringStreamTest2.dir/tests/stringStreamTest2.cpp.o"
+  "CMakeFiles/io_stringStreamTest2.dir/tests/stringStreamTest2.cpp.o.d"
+  "stringStreamTest2"
+  "stringStreamTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_stringStreamTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
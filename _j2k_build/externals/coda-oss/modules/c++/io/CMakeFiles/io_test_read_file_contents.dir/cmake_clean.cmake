@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_test_read_file_contents.dir/tests/test_read_file_contents.cpp.o"
+  "CMakeFiles/io_test_read_file_contents.dir/tests/test_read_file_contents.cpp.o.d"
+  "test_read_file_contents"
+  "test_read_file_contents.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_test_read_file_contents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_test_stream_splitter.dir/unittests/test_stream_splitter.cpp.o"
+  "CMakeFiles/io_test_stream_splitter.dir/unittests/test_stream_splitter.cpp.o.d"
+  "test_stream_splitter"
+  "test_stream_splitter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_test_stream_splitter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
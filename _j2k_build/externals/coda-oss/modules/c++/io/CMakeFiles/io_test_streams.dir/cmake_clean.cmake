@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_test_streams.dir/unittests/test_streams.cpp.o"
+  "CMakeFiles/io_test_streams.dir/unittests/test_streams.cpp.o.d"
+  "test_streams"
+  "test_streams.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_test_streams.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_test_tempfile.dir/unittests/test_tempfile.cpp.o"
+  "CMakeFiles/io_test_tempfile.dir/unittests/test_tempfile.cpp.o.d"
+  "test_tempfile"
+  "test_tempfile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_test_tempfile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
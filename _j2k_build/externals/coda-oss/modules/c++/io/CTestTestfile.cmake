@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/io
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/io
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(io_test_stream_splitter "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/test_stream_splitter")
+set_tests_properties(io_test_stream_splitter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;13;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;0;")
+add_test(io_test_streams "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/test_streams")
+set_tests_properties(io_test_streams PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;13;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;0;")
+add_test(io_test_tempfile "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/test_tempfile")
+set_tests_properties(io_test_tempfile PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;13;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/io/CMakeLists.txt;0;")
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/DefaultLogger.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/DefaultLogger.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/DefaultLogger.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Filter.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Filter.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Filter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Filterer.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Filterer.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Filterer.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Formatter.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Formatter.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Formatter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Handler.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Handler.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Handler.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/LogRecord.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/LogRecord.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/LogRecord.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Logger.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Logger.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Logger.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/LoggerFactory.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/LoggerFactory.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/LoggerFactory.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/MemoryHandler.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/MemoryHandler.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/MemoryHandler.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/RotatingFileHandler.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/RotatingFileHandler.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/RotatingFileHandler.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/Setup.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Setup.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/Setup.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/StandardFormatter.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/StandardFormatter.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/StandardFormatter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/StreamHandler.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/StreamHandler.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/StreamHandler.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/logging/source/XMLFormatter.cpp" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/XMLFormatter.cpp.o" "gcc" "externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/source/XMLFormatter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/CMakeFiles/mt-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/CMakeFiles/mem-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/CMakeFiles/math-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logging-c++.dir/source/DefaultLogger.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/DefaultLogger.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Filter.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Filter.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Filterer.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Filterer.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Formatter.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Formatter.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Handler.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Handler.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/LogRecord.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/LogRecord.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Logger.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Logger.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/LoggerFactory.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/LoggerFactory.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/MemoryHandler.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/MemoryHandler.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/RotatingFileHandler.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/RotatingFileHandler.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/Setup.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/Setup.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/StandardFormatter.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/StandardFormatter.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/StreamHandler.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/StreamHandler.cpp.o.d"
+  "CMakeFiles/logging-c++.dir/source/XMLFormatter.cpp.o"
+  "CMakeFiles/logging-c++.dir/source/XMLFormatter.cpp.o.d"
+  "liblogging-c++.a"
+  "liblogging-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicLoggerTest"
+  "BasicLoggerTest.pdb"
+  "CMakeFiles/logging_BasicLoggerTest.dir/tests/BasicLoggerTest.cpp.o"
+  "CMakeFiles/logging_BasicLoggerTest.dir/tests/BasicLoggerTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_BasicLoggerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logging_FactoryTest.dir/tests/FactoryTest.cpp.o"
+  "CMakeFiles/logging_FactoryTest.dir/tests/FactoryTest.cpp.o.d"
+  "FactoryTest"
+  "FactoryTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_FactoryTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logging_RotatingLoggerTest.dir/tests/RotatingLoggerTest.cpp.o"
+  "CMakeFiles/logging_RotatingLoggerTest.dir/tests/RotatingLoggerTest.cpp.o.d"
+  "RotatingLoggerTest"
+  "RotatingLoggerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_RotatingLoggerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logging_test_exception_logger.dir/unittests/test_exception_logger.cpp.o"
+  "CMakeFiles/logging_test_exception_logger.dir/unittests/test_exception_logger.cpp.o.d"
+  "test_exception_logger"
+  "test_exception_logger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_test_exception_logger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
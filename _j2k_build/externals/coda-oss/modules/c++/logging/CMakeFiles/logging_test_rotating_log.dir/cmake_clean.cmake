@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logging_test_rotating_log.dir/unittests/test_rotating_log.cpp.o"
+  "CMakeFiles/logging_test_rotating_log.dir/unittests/test_rotating_log.cpp.o.d"
+  "test_rotating_log"
+  "test_rotating_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logging_test_rotating_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
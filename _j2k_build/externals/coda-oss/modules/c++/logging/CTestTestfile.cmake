@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/logging
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/logging
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(logging_test_exception_logger "/root/repo/_j2k_build/externals/coda-oss/modules/c++/logging/test_exception_logger")
+set_tests_properties(logging_test_exception_logger PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/logging/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/logging/CMakeLists.txt;0;")
+add_test(logging_test_rotating_log "/root/repo/_j2k_build/externals/coda-oss/modules/c++/logging/test_rotating_log")
+set_tests_properties(logging_test_rotating_log PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/logging/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/logging/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear-c++.dir/source/Line2D.cpp.o"
+  "CMakeFiles/math.linear-c++.dir/source/Line2D.cpp.o.d"
+  "libmath.linear-c++.a"
+  "libmath.linear-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_Vector.dir/unittests/test_Vector.cpp.o"
+  "CMakeFiles/math.linear_test_Vector.dir/unittests/test_Vector.cpp.o.d"
+  "test_Vector"
+  "test_Vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_Vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_VectorN.dir/unittests/test_VectorN.cpp.o"
+  "CMakeFiles/math.linear_test_VectorN.dir/unittests/test_VectorN.cpp.o.d"
+  "test_VectorN"
+  "test_VectorN.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_VectorN.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
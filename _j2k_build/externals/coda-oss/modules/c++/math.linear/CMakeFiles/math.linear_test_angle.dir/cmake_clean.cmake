@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_angle.dir/tests/test_angle.cpp.o"
+  "CMakeFiles/math.linear_test_angle.dir/tests/test_angle.cpp.o.d"
+  "test_angle"
+  "test_angle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_angle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_cx.dir/tests/test_cx.cpp.o"
+  "CMakeFiles/math.linear_test_cx.dir/tests/test_cx.cpp.o.d"
+  "test_cx"
+  "test_cx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_cx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_diag.dir/tests/test_diag.cpp.o"
+  "CMakeFiles/math.linear_test_diag.dir/tests/test_diag.cpp.o.d"
+  "test_diag"
+  "test_diag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_diag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
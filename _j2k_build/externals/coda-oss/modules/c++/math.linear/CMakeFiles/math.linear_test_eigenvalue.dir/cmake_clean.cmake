@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_eigenvalue.dir/unittests/test_eigenvalue.cpp.o"
+  "CMakeFiles/math.linear_test_eigenvalue.dir/unittests/test_eigenvalue.cpp.o.d"
+  "test_eigenvalue"
+  "test_eigenvalue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_eigenvalue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
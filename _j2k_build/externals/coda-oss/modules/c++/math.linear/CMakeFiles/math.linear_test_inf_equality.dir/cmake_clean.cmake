@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_inf_equality.dir/unittests/test_inf_equality.cpp.o"
+  "CMakeFiles/math.linear_test_inf_equality.dir/unittests/test_inf_equality.cpp.o.d"
+  "test_inf_equality"
+  "test_inf_equality.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_inf_equality.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
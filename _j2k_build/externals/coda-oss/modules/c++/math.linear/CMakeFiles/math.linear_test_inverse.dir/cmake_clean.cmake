@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_inverse.dir/unittests/test_inverse.cpp.o"
+  "CMakeFiles/math.linear_test_inverse.dir/unittests/test_inverse.cpp.o.d"
+  "test_inverse"
+  "test_inverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_inverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
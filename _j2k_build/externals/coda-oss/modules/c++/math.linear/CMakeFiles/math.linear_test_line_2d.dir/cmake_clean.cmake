@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_line_2d.dir/tests/test_line_2d.cpp.o"
+  "CMakeFiles/math.linear_test_line_2d.dir/tests/test_line_2d.cpp.o.d"
+  "test_line_2d"
+  "test_line_2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_line_2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_mx.dir/unittests/test_mx.cpp.o"
+  "CMakeFiles/math.linear_test_mx.dir/unittests/test_mx.cpp.o.d"
+  "test_mx"
+  "test_mx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_mx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
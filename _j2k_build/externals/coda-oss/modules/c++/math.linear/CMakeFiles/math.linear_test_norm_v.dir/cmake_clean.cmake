@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_norm_v.dir/tests/test_norm_v.cpp.o"
+  "CMakeFiles/math.linear_test_norm_v.dir/tests/test_norm_v.cpp.o.d"
+  "test_norm_v"
+  "test_norm_v.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_norm_v.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.linear_test_norm_vN.dir/tests/test_norm_vN.cpp.o"
+  "CMakeFiles/math.linear_test_norm_vN.dir/tests/test_norm_vN.cpp.o.d"
+  "test_norm_vN"
+  "test_norm_vN.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.linear_test_norm_vN.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/math.linear
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(math.linear_test_Vector "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_Vector")
+set_tests_properties(math.linear_test_Vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_VectorN "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_VectorN")
+set_tests_properties(math.linear_test_VectorN PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_eigenvalue "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_eigenvalue")
+set_tests_properties(math.linear_test_eigenvalue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_inf_equality "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_inf_equality")
+set_tests_properties(math.linear_test_inf_equality PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_inverse "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_inverse")
+set_tests_properties(math.linear_test_inverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_lin "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_lin")
+set_tests_properties(math.linear_test_lin PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
+add_test(math.linear_test_mx "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.linear/test_mx")
+set_tests_properties(math.linear_test_mx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.linear/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.poly_test_OneD_templates.dir/tests/test_OneD_templates.cpp.o"
+  "CMakeFiles/math.poly_test_OneD_templates.dir/tests/test_OneD_templates.cpp.o.d"
+  "test_OneD_templates"
+  "test_OneD_templates.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.poly_test_OneD_templates.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
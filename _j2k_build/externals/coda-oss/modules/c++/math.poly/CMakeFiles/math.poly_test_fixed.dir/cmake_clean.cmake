@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.poly_test_fixed.dir/tests/test_fixed.cpp.o"
+  "CMakeFiles/math.poly_test_fixed.dir/tests/test_fixed.cpp.o.d"
+  "test_fixed"
+  "test_fixed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.poly_test_fixed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.poly_test_fixed_1d_poly.dir/unittests/test_fixed_1d_poly.cpp.o"
+  "CMakeFiles/math.poly_test_fixed_1d_poly.dir/unittests/test_fixed_1d_poly.cpp.o.d"
+  "test_fixed_1d_poly"
+  "test_fixed_1d_poly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.poly_test_fixed_1d_poly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.poly_test_inner_poly.dir/tests/test_inner_poly.cpp.o"
+  "CMakeFiles/math.poly_test_inner_poly.dir/tests/test_inner_poly.cpp.o.d"
+  "test_inner_poly"
+  "test_inner_poly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.poly_test_inner_poly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
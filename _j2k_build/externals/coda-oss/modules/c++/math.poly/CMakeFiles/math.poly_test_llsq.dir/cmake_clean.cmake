@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math.poly_test_llsq.dir/unittests/test_llsq.cpp.o"
+  "CMakeFiles/math.poly_test_llsq.dir/unittests/test_llsq.cpp.o.d"
+  "test_llsq"
+  "test_llsq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math.poly_test_llsq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
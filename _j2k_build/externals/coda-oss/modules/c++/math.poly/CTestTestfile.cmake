@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/math.poly
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(math.poly_test_1d_poly "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly/test_1d_poly")
+set_tests_properties(math.poly_test_1d_poly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;0;")
+add_test(math.poly_test_2d_poly "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly/test_2d_poly")
+set_tests_properties(math.poly_test_2d_poly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;0;")
+add_test(math.poly_test_fixed_1d_poly "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly/test_fixed_1d_poly")
+set_tests_properties(math.poly_test_fixed_1d_poly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;0;")
+add_test(math.poly_test_fixed_2d_poly "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly/test_fixed_2d_poly")
+set_tests_properties(math.poly_test_fixed_2d_poly PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;0;")
+add_test(math.poly_test_llsq "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math.poly/test_llsq")
+set_tests_properties(math.poly_test_llsq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;17;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math.poly/CMakeLists.txt;0;")
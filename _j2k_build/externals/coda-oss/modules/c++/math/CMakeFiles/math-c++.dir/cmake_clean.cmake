@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math-c++.dir/source/Bessel.cpp.o"
+  "CMakeFiles/math-c++.dir/source/Bessel.cpp.o.d"
+  "CMakeFiles/math-c++.dir/source/Round.cpp.o"
+  "CMakeFiles/math-c++.dir/source/Round.cpp.o.d"
+  "CMakeFiles/math-c++.dir/source/Utilities.cpp.o"
+  "CMakeFiles/math-c++.dir/source/Utilities.cpp.o.d"
+  "libmath-c++.a"
+  "libmath-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
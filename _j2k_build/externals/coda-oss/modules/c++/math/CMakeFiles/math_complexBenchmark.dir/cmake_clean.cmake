@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_complexBenchmark.dir/tests/complexBenchmark.cpp.o"
+  "CMakeFiles/math_complexBenchmark.dir/tests/complexBenchmark.cpp.o.d"
+  "complexBenchmark"
+  "complexBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_complexBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_complexMultiplyBenchmark.dir/tests/complexMultiplyBenchmark.cpp.o"
+  "CMakeFiles/math_complexMultiplyBenchmark.dir/tests/complexMultiplyBenchmark.cpp.o.d"
+  "complexMultiplyBenchmark"
+  "complexMultiplyBenchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_complexMultiplyBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_bessel_functions.dir/unittests/test_bessel_functions.cpp.o"
+  "CMakeFiles/math_test_bessel_functions.dir/unittests/test_bessel_functions.cpp.o.d"
+  "test_bessel_functions"
+  "test_bessel_functions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_bessel_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_convex_hull.dir/unittests/test_convex_hull.cpp.o"
+  "CMakeFiles/math_test_convex_hull.dir/unittests/test_convex_hull.cpp.o.d"
+  "test_convex_hull"
+  "test_convex_hull.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_convex_hull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_is_nan.dir/unittests/test_is_nan.cpp.o"
+  "CMakeFiles/math_test_is_nan.dir/unittests/test_is_nan.cpp.o.d"
+  "test_is_nan"
+  "test_is_nan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_is_nan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
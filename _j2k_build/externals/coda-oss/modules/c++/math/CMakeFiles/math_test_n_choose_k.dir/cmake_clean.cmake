@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_n_choose_k.dir/unittests/test_n_choose_k.cpp.o"
+  "CMakeFiles/math_test_n_choose_k.dir/unittests/test_n_choose_k.cpp.o.d"
+  "test_n_choose_k"
+  "test_n_choose_k.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_n_choose_k.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
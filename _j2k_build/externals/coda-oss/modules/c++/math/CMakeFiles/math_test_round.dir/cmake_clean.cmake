@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_round.dir/unittests/test_round.cpp.o"
+  "CMakeFiles/math_test_round.dir/unittests/test_round.cpp.o.d"
+  "test_round"
+  "test_round.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_round.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test_sign.dir/unittests/test_sign.cpp.o"
+  "CMakeFiles/math_test_sign.dir/unittests/test_sign.cpp.o.d"
+  "test_sign"
+  "test_sign.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test_sign.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/math
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/math
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(math_test_bessel_functions "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_bessel_functions")
+set_tests_properties(math_test_bessel_functions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
+add_test(math_test_convex_hull "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_convex_hull")
+set_tests_properties(math_test_convex_hull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
+add_test(math_test_is_nan "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_is_nan")
+set_tests_properties(math_test_is_nan PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
+add_test(math_test_n_choose_k "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_n_choose_k")
+set_tests_properties(math_test_n_choose_k PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
+add_test(math_test_round "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_round")
+set_tests_properties(math_test_round PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
+add_test(math_test_sign "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/test_sign")
+set_tests_properties(math_test_sign PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/math/CMakeLists.txt;0;")
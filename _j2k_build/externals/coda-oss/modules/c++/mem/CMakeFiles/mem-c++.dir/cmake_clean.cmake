@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem-c++.dir/source/Align.cpp.o"
+  "CMakeFiles/mem-c++.dir/source/Align.cpp.o.d"
+  "CMakeFiles/mem-c++.dir/source/ScratchMemory.cpp.o"
+  "CMakeFiles/mem-c++.dir/source/ScratchMemory.cpp.o.d"
+  "libmem-c++.a"
+  "libmem-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_ScratchVisualization.dir/tests/ScratchVisualization.cpp.o"
+  "CMakeFiles/mem_ScratchVisualization.dir/tests/ScratchVisualization.cpp.o.d"
+  "ScratchVisualization"
+  "ScratchVisualization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_ScratchVisualization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
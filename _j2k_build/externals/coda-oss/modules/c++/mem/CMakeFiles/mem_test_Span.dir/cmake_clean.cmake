@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_test_Span.dir/unittests/test_Span.cpp.o"
+  "CMakeFiles/mem_test_Span.dir/unittests/test_Span.cpp.o.d"
+  "test_Span"
+  "test_Span.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_test_Span.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_test_scoped_cloneable_ptr.dir/unittests/test_scoped_cloneable_ptr.cpp.o"
+  "CMakeFiles/mem_test_scoped_cloneable_ptr.dir/unittests/test_scoped_cloneable_ptr.cpp.o.d"
+  "test_scoped_cloneable_ptr"
+  "test_scoped_cloneable_ptr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_test_scoped_cloneable_ptr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_test_scratch_memory.dir/unittests/test_scratch_memory.cpp.o"
+  "CMakeFiles/mem_test_scratch_memory.dir/unittests/test_scratch_memory.cpp.o.d"
+  "test_scratch_memory"
+  "test_scratch_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_test_scratch_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_test_shared_ptr.dir/unittests/test_shared_ptr.cpp.o"
+  "CMakeFiles/mem_test_shared_ptr.dir/unittests/test_shared_ptr.cpp.o.d"
+  "test_shared_ptr"
+  "test_shared_ptr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_test_shared_ptr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
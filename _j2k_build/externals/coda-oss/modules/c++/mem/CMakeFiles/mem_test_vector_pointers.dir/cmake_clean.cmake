@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mem_test_vector_pointers.dir/unittests/test_vector_pointers.cpp.o"
+  "CMakeFiles/mem_test_vector_pointers.dir/unittests/test_vector_pointers.cpp.o.d"
+  "test_vector_pointers"
+  "test_vector_pointers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_test_vector_pointers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/mem
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/mem
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(mem_test_Span "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_Span")
+set_tests_properties(mem_test_Span PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_scoped_cloneable_ptr "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_scoped_cloneable_ptr")
+set_tests_properties(mem_test_scoped_cloneable_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_scoped_copyable_ptr "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_scoped_copyable_ptr")
+set_tests_properties(mem_test_scoped_copyable_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_scratch_memory "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_scratch_memory")
+set_tests_properties(mem_test_scratch_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_shared_ptr "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_shared_ptr")
+set_tests_properties(mem_test_shared_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_unique_ptr "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_unique_ptr")
+set_tests_properties(mem_test_unique_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
+add_test(mem_test_vector_pointers "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/test_vector_pointers")
+set_tests_properties(mem_test_vector_pointers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mem/CMakeLists.txt;0;")
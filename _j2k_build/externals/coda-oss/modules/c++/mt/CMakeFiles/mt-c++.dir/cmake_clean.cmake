@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt-c++.dir/source/CPUAffinityInitializerLinux.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/CPUAffinityInitializerLinux.cpp.o.d"
+  "CMakeFiles/mt-c++.dir/source/CPUAffinityThreadInitializerLinux.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/CPUAffinityThreadInitializerLinux.cpp.o.d"
+  "CMakeFiles/mt-c++.dir/source/GenerationThreadPool.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/GenerationThreadPool.cpp.o.d"
+  "CMakeFiles/mt-c++.dir/source/GenericRequestHandler.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/GenericRequestHandler.cpp.o.d"
+  "CMakeFiles/mt-c++.dir/source/ThreadGroup.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/ThreadGroup.cpp.o.d"
+  "CMakeFiles/mt-c++.dir/source/ThreadPlanner.cpp.o"
+  "CMakeFiles/mt-c++.dir/source/ThreadPlanner.cpp.o.d"
+  "libmt-c++.a"
+  "libmt-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
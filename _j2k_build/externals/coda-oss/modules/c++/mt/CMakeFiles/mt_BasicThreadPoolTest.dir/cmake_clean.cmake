@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicThreadPoolTest"
+  "BasicThreadPoolTest.pdb"
+  "CMakeFiles/mt_BasicThreadPoolTest.dir/tests/BasicThreadPoolTest.cpp.o"
+  "CMakeFiles/mt_BasicThreadPoolTest.dir/tests/BasicThreadPoolTest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_BasicThreadPoolTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_GenerationThreadPoolTest.dir/tests/GenerationThreadPoolTest.cpp.o"
+  "CMakeFiles/mt_GenerationThreadPoolTest.dir/tests/GenerationThreadPoolTest.cpp.o.d"
+  "GenerationThreadPoolTest"
+  "GenerationThreadPoolTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_GenerationThreadPoolTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
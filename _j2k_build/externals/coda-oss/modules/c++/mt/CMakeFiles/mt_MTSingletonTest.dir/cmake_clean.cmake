@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_MTSingletonTest.dir/tests/MTSingletonTest.cpp.o"
+  "CMakeFiles/mt_MTSingletonTest.dir/tests/MTSingletonTest.cpp.o.d"
+  "MTSingletonTest"
+  "MTSingletonTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_MTSingletonTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_Runnable1DTest.dir/unittests/Runnable1DTest.cpp.o"
+  "CMakeFiles/mt_Runnable1DTest.dir/unittests/Runnable1DTest.cpp.o.d"
+  "Runnable1DTest"
+  "Runnable1DTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_Runnable1DTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
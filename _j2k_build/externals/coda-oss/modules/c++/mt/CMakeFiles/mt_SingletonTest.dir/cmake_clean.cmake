@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_SingletonTest.dir/tests/SingletonTest.cpp.o"
+  "CMakeFiles/mt_SingletonTest.dir/tests/SingletonTest.cpp.o.d"
+  "SingletonTest"
+  "SingletonTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_SingletonTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_ThreadExceptionTest.dir/tests/ThreadExceptionTest.cpp.o"
+  "CMakeFiles/mt_ThreadExceptionTest.dir/tests/ThreadExceptionTest.cpp.o.d"
+  "ThreadExceptionTest"
+  "ThreadExceptionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_ThreadExceptionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_ThreadGroupAffinityTest.dir/tests/ThreadGroupAffinityTest.cpp.o"
+  "CMakeFiles/mt_ThreadGroupAffinityTest.dir/tests/ThreadGroupAffinityTest.cpp.o.d"
+  "ThreadGroupAffinityTest"
+  "ThreadGroupAffinityTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_ThreadGroupAffinityTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_ThreadGroupTest.dir/unittests/ThreadGroupTest.cpp.o"
+  "CMakeFiles/mt_ThreadGroupTest.dir/unittests/ThreadGroupTest.cpp.o.d"
+  "ThreadGroupTest"
+  "ThreadGroupTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_ThreadGroupTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
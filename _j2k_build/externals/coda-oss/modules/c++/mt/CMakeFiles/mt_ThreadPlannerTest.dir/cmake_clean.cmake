@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_ThreadPlannerTest.dir/unittests/ThreadPlannerTest.cpp.o"
+  "CMakeFiles/mt_ThreadPlannerTest.dir/unittests/ThreadPlannerTest.cpp.o.d"
+  "ThreadPlannerTest"
+  "ThreadPlannerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_ThreadPlannerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
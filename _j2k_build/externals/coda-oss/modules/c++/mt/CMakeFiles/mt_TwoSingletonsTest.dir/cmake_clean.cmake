@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_TwoSingletonsTest.dir/tests/TwoSingletonsTest.cpp.o"
+  "CMakeFiles/mt_TwoSingletonsTest.dir/tests/TwoSingletonsTest.cpp.o.d"
+  "TwoSingletonsTest"
+  "TwoSingletonsTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_TwoSingletonsTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
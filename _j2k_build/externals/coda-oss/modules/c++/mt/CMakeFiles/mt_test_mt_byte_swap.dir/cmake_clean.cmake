@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_test_mt_byte_swap.dir/unittests/test_mt_byte_swap.cpp.o"
+  "CMakeFiles/mt_test_mt_byte_swap.dir/unittests/test_mt_byte_swap.cpp.o.d"
+  "test_mt_byte_swap"
+  "test_mt_byte_swap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_test_mt_byte_swap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
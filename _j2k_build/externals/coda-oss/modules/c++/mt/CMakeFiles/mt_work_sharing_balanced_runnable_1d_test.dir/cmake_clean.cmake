@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mt_work_sharing_balanced_runnable_1d_test.dir/unittests/work_sharing_balanced_runnable_1d_test.cpp.o"
+  "CMakeFiles/mt_work_sharing_balanced_runnable_1d_test.dir/unittests/work_sharing_balanced_runnable_1d_test.cpp.o.d"
+  "work_sharing_balanced_runnable_1d_test"
+  "work_sharing_balanced_runnable_1d_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mt_work_sharing_balanced_runnable_1d_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
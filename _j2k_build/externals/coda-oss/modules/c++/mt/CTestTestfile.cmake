@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/mt
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/mt
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(mt_Runnable1DTest "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/Runnable1DTest")
+set_tests_properties(mt_Runnable1DTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
+add_test(mt_ThreadGroupTest "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/ThreadGroupTest")
+set_tests_properties(mt_ThreadGroupTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
+add_test(mt_ThreadPlannerTest "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/ThreadPlannerTest")
+set_tests_properties(mt_ThreadPlannerTest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
+add_test(mt_balanced_runnable_1d_test "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/balanced_runnable_1d_test")
+set_tests_properties(mt_balanced_runnable_1d_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
+add_test(mt_test_mt_byte_swap "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/test_mt_byte_swap")
+set_tests_properties(mt_test_mt_byte_swap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
+add_test(mt_work_sharing_balanced_runnable_1d_test "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/work_sharing_balanced_runnable_1d_test")
+set_tests_properties(mt_work_sharing_balanced_runnable_1d_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;16;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/mt/CMakeLists.txt;0;")
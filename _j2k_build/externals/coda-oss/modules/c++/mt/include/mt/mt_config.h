@@ -0,0 +1,6 @@
+#ifndef _mt_CONFIG_H_
+#define _mt_CONFIG_H_
+
+/* #undef MT_DEFAULT_PINNING */
+
+#endif /* _mt_CONFIG_H_ */
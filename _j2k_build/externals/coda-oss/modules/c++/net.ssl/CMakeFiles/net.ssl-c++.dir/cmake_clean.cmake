@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net.ssl-c++.dir/source/SSLConnection.cpp.o"
+  "CMakeFiles/net.ssl-c++.dir/source/SSLConnection.cpp.o.d"
+  "CMakeFiles/net.ssl-c++.dir/source/SSLConnectionClientFactory.cpp.o"
+  "CMakeFiles/net.ssl-c++.dir/source/SSLConnectionClientFactory.cpp.o.d"
+  "libnet.ssl-c++.a"
+  "libnet.ssl-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net.ssl-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
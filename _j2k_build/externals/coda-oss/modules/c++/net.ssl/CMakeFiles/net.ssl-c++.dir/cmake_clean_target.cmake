@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libnet.ssl-c++.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net.ssl_SSLTestClient.dir/tests/SSLTestClient.cpp.o"
+  "CMakeFiles/net.ssl_SSLTestClient.dir/tests/SSLTestClient.cpp.o.d"
+  "SSLTestClient"
+  "SSLTestClient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net.ssl_SSLTestClient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
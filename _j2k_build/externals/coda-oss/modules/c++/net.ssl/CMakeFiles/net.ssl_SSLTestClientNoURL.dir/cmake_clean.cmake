@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net.ssl_SSLTestClientNoURL.dir/tests/SSLTestClientNoURL.cpp.o"
+  "CMakeFiles/net.ssl_SSLTestClientNoURL.dir/tests/SSLTestClientNoURL.cpp.o.d"
+  "SSLTestClientNoURL"
+  "SSLTestClientNoURL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net.ssl_SSLTestClientNoURL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+#ifndef _net_ssl_CONFIG_H_
+#define _net_ssl_CONFIG_H_
+
+/* #undef  */
+
+#endif /* _net_ssl_CONFIG_H_ */
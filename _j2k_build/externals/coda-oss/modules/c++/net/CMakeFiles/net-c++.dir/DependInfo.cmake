@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/net/source/CurlHandle.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/CurlHandle.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/CurlHandle.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/CurlInit.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/CurlInit.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/CurlInit.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/DaemonUnix.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/DaemonUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/DaemonUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/NetConnection.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnection.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnection.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/NetConnectionClientFactory.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnectionClientFactory.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnectionClientFactory.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/NetConnectionServer.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnectionServer.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetConnectionServer.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/NetUtils.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetUtils.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/NetUtils.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/PerRequestThreadAllocStrategy.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/PerRequestThreadAllocStrategy.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/PerRequestThreadAllocStrategy.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/Socket.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/Socket.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/Socket.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/SocketAddress.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/SocketAddress.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/SocketAddress.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/ThreadPoolAllocStrategy.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/ThreadPoolAllocStrategy.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/ThreadPoolAllocStrategy.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/net/source/URL.cpp" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/URL.cpp.o" "gcc" "externals/coda-oss/modules/c++/net/CMakeFiles/net-c++.dir/source/URL.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/logging/CMakeFiles/logging-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/re/CMakeFiles/re-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/CMakeFiles/mem-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/CMakeFiles/mt-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/CMakeFiles/math-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/drivers/pcre/CMakeFiles/pcre2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net-c++.dir/source/CurlHandle.cpp.o"
+  "CMakeFiles/net-c++.dir/source/CurlHandle.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/CurlInit.cpp.o"
+  "CMakeFiles/net-c++.dir/source/CurlInit.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/DaemonUnix.cpp.o"
+  "CMakeFiles/net-c++.dir/source/DaemonUnix.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/NetConnection.cpp.o"
+  "CMakeFiles/net-c++.dir/source/NetConnection.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/NetConnectionClientFactory.cpp.o"
+  "CMakeFiles/net-c++.dir/source/NetConnectionClientFactory.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/NetConnectionServer.cpp.o"
+  "CMakeFiles/net-c++.dir/source/NetConnectionServer.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/NetUtils.cpp.o"
+  "CMakeFiles/net-c++.dir/source/NetUtils.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/PerRequestThreadAllocStrategy.cpp.o"
+  "CMakeFiles/net-c++.dir/source/PerRequestThreadAllocStrategy.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/Socket.cpp.o"
+  "CMakeFiles/net-c++.dir/source/Socket.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/SocketAddress.cpp.o"
+  "CMakeFiles/net-c++.dir/source/SocketAddress.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/ThreadPoolAllocStrategy.cpp.o"
+  "CMakeFiles/net-c++.dir/source/ThreadPoolAllocStrategy.cpp.o.d"
+  "CMakeFiles/net-c++.dir/source/URL.cpp.o"
+  "CMakeFiles/net-c++.dir/source/URL.cpp.o.d"
+  "libnet-c++.a"
+  "libnet-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_NetConnectionClientTest.dir/tests/NetConnectionClientTest.cpp.o"
+  "CMakeFiles/net_NetConnectionClientTest.dir/tests/NetConnectionClientTest.cpp.o.d"
+  "NetConnectionClientTest"
+  "NetConnectionClientTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_NetConnectionClientTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
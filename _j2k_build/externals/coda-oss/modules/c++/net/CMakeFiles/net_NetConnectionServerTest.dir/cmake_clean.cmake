@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_NetConnectionServerTest.dir/tests/NetConnectionServerTest.cpp.o"
+  "CMakeFiles/net_NetConnectionServerTest.dir/tests/NetConnectionServerTest.cpp.o.d"
+  "NetConnectionServerTest"
+  "NetConnectionServerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_NetConnectionServerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
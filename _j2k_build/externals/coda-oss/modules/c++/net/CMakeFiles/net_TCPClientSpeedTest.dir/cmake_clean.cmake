@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_TCPClientSpeedTest.dir/tests/TCPClientSpeedTest.cpp.o"
+  "CMakeFiles/net_TCPClientSpeedTest.dir/tests/TCPClientSpeedTest.cpp.o.d"
+  "TCPClientSpeedTest"
+  "TCPClientSpeedTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_TCPClientSpeedTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
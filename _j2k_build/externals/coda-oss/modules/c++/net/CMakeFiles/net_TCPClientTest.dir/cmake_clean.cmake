@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_TCPClientTest.dir/tests/TCPClientTest.cpp.o"
+  "CMakeFiles/net_TCPClientTest.dir/tests/TCPClientTest.cpp.o.d"
+  "TCPClientTest"
+  "TCPClientTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_TCPClientTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_TCPServerSpeedTest.dir/tests/TCPServerSpeedTest.cpp.o"
+  "CMakeFiles/net_TCPServerSpeedTest.dir/tests/TCPServerSpeedTest.cpp.o.d"
+  "TCPServerSpeedTest"
+  "TCPServerSpeedTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_TCPServerSpeedTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
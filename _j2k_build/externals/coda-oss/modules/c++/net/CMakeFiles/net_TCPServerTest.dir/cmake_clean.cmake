@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_TCPServerTest.dir/tests/TCPServerTest.cpp.o"
+  "CMakeFiles/net_TCPServerTest.dir/tests/TCPServerTest.cpp.o.d"
+  "TCPServerTest"
+  "TCPServerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_TCPServerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
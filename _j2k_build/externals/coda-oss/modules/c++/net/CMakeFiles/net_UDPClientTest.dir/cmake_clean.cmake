@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_UDPClientTest.dir/tests/UDPClientTest.cpp.o"
+  "CMakeFiles/net_UDPClientTest.dir/tests/UDPClientTest.cpp.o.d"
+  "UDPClientTest"
+  "UDPClientTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_UDPClientTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_UDPServerTest.dir/tests/UDPServerTest.cpp.o"
+  "CMakeFiles/net_UDPServerTest.dir/tests/UDPServerTest.cpp.o.d"
+  "UDPServerTest"
+  "UDPServerTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_UDPServerTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
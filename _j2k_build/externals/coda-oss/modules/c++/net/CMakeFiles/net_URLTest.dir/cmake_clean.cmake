@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/net_URLTest.dir/tests/URLTest.cpp.o"
+  "CMakeFiles/net_URLTest.dir/tests/URLTest.cpp.o.d"
+  "URLTest"
+  "URLTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/net_URLTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+#ifndef _net_CONFIG_H_
+#define _net_CONFIG_H_
+
+/* #undef HAVE_CURL */
+#define NET_CURL_SUPPORT 1
+
+#endif /* _net_CONFIG_H_ */
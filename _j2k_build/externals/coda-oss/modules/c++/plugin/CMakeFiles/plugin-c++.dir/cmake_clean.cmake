@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/plugin-c++.dir/source/ErrorHandler.cpp.o"
+  "CMakeFiles/plugin-c++.dir/source/ErrorHandler.cpp.o.d"
+  "libplugin-c++.a"
+  "libplugin-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/plugin-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
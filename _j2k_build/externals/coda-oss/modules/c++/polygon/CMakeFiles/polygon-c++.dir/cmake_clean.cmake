@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polygon-c++.dir/source/PolygonMask.cpp.o"
+  "CMakeFiles/polygon-c++.dir/source/PolygonMask.cpp.o.d"
+  "libpolygon-c++.a"
+  "libpolygon-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polygon-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polygon_test_draw_polygon.dir/tests/test_draw_polygon.cpp.o"
+  "CMakeFiles/polygon_test_draw_polygon.dir/tests/test_draw_polygon.cpp.o.d"
+  "test_draw_polygon"
+  "test_draw_polygon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polygon_test_draw_polygon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
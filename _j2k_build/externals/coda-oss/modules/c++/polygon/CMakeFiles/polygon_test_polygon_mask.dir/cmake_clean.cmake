@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polygon_test_polygon_mask.dir/unittests/test_polygon_mask.cpp.o"
+  "CMakeFiles/polygon_test_polygon_mask.dir/unittests/test_polygon_mask.cpp.o.d"
+  "test_polygon_mask"
+  "test_polygon_mask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polygon_test_polygon_mask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
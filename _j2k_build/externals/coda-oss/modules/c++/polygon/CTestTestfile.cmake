@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/polygon
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/polygon
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(polygon_test_polygon_mask "/root/repo/_j2k_build/externals/coda-oss/modules/c++/polygon/test_polygon_mask")
+set_tests_properties(polygon_test_polygon_mask PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/polygon/CMakeLists.txt;12;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/polygon/CMakeLists.txt;0;")
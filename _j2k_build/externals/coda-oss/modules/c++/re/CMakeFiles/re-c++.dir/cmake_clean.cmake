@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re-c++.dir/source/Regex.cpp.o"
+  "CMakeFiles/re-c++.dir/source/Regex.cpp.o.d"
+  "CMakeFiles/re-c++.dir/source/RegexPCRE.cpp.o"
+  "CMakeFiles/re-c++.dir/source/RegexPCRE.cpp.o.d"
+  "CMakeFiles/re-c++.dir/source/RegexSTL.cpp.o"
+  "CMakeFiles/re-c++.dir/source/RegexSTL.cpp.o.d"
+  "libre-c++.a"
+  "libre-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
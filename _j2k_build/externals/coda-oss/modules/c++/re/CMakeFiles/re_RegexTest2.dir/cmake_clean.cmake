@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re_RegexTest2.dir/tests/RegexTest2.cpp.o"
+  "CMakeFiles/re_RegexTest2.dir/tests/RegexTest2.cpp.o.d"
+  "RegexTest2"
+  "RegexTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re_RegexTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re_RegexTest3.dir/tests/RegexTest3.cpp.o"
+  "CMakeFiles/re_RegexTest3.dir/tests/RegexTest3.cpp.o.d"
+  "RegexTest3"
+  "RegexTest3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re_RegexTest3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
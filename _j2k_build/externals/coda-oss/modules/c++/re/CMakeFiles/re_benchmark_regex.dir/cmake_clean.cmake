@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re_benchmark_regex.dir/tests/benchmark_regex.cpp.o"
+  "CMakeFiles/re_benchmark_regex.dir/tests/benchmark_regex.cpp.o.d"
+  "benchmark_regex"
+  "benchmark_regex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re_benchmark_regex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
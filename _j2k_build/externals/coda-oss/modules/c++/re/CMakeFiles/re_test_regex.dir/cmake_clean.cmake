@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/re_test_regex.dir/unittests/test_regex.cpp.o"
+  "CMakeFiles/re_test_regex.dir/unittests/test_regex.cpp.o.d"
+  "test_regex"
+  "test_regex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/re_test_regex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
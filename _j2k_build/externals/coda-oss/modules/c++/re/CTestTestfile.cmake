@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/re
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/re
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(re_test_regex "/root/repo/_j2k_build/externals/coda-oss/modules/c++/re/test_regex")
+set_tests_properties(re_test_regex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/re/CMakeLists.txt;33;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/re/CMakeLists.txt;0;")
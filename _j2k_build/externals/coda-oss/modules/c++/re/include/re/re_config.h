@@ -0,0 +1,7 @@
+#ifndef _re_CONFIG_H_
+#define _re_CONFIG_H_
+
+/* #undef RE_ENABLE_STD_REGEX */
+/* #undef PCRE2_STATIC */
+
+#endif /* _re_CONFIG_H_ */
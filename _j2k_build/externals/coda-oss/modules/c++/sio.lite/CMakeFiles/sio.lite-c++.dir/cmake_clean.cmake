@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sio.lite-c++.dir/source/FileHeader.cpp.o"
+  "CMakeFiles/sio.lite-c++.dir/source/FileHeader.cpp.o.d"
+  "CMakeFiles/sio.lite-c++.dir/source/SioFileReader.cpp.o"
+  "CMakeFiles/sio.lite-c++.dir/source/SioFileReader.cpp.o.d"
+  "CMakeFiles/sio.lite-c++.dir/source/SioFileWriter.cpp.o"
+  "CMakeFiles/sio.lite-c++.dir/source/SioFileWriter.cpp.o.d"
+  "CMakeFiles/sio.lite-c++.dir/source/StreamReader.cpp.o"
+  "CMakeFiles/sio.lite-c++.dir/source/StreamReader.cpp.o.d"
+  "libsio.lite-c++.a"
+  "libsio.lite-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sio.lite-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
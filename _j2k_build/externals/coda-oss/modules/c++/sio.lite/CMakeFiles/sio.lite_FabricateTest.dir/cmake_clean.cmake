@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sio.lite_FabricateTest.dir/tests/FabricateTest.cpp.o"
+  "CMakeFiles/sio.lite_FabricateTest.dir/tests/FabricateTest.cpp.o.d"
+  "FabricateTest"
+  "FabricateTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sio.lite_FabricateTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sio.lite_RoundTripTest.dir/tests/RoundTripTest.cpp.o"
+  "CMakeFiles/sio.lite_RoundTripTest.dir/tests/RoundTripTest.cpp.o.d"
+  "RoundTripTest"
+  "RoundTripTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sio.lite_RoundTripTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sio.lite_imdmphdr.dir/tests/imdmphdr.cpp.o"
+  "CMakeFiles/sio.lite_imdmphdr.dir/tests/imdmphdr.cpp.o.d"
+  "imdmphdr"
+  "imdmphdr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sio.lite_imdmphdr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
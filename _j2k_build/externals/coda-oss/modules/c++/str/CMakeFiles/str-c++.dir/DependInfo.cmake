@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/str/source/Convert.cpp" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Convert.cpp.o" "gcc" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Convert.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/str/source/Encoding.cpp" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Encoding.cpp.o" "gcc" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Encoding.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/str/source/Format.cpp" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Format.cpp.o" "gcc" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Format.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/str/source/Manip.cpp" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Manip.cpp.o" "gcc" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Manip.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/str/source/Tokenizer.cpp" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Tokenizer.cpp.o" "gcc" "externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/source/Tokenizer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
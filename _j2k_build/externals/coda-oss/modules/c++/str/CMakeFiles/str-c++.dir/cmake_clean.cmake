@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/str-c++.dir/source/Convert.cpp.o"
+  "CMakeFiles/str-c++.dir/source/Convert.cpp.o.d"
+  "CMakeFiles/str-c++.dir/source/Encoding.cpp.o"
+  "CMakeFiles/str-c++.dir/source/Encoding.cpp.o.d"
+  "CMakeFiles/str-c++.dir/source/Format.cpp.o"
+  "CMakeFiles/str-c++.dir/source/Format.cpp.o.d"
+  "CMakeFiles/str-c++.dir/source/Manip.cpp.o"
+  "CMakeFiles/str-c++.dir/source/Manip.cpp.o.d"
+  "CMakeFiles/str-c++.dir/source/Tokenizer.cpp.o"
+  "CMakeFiles/str-c++.dir/source/Tokenizer.cpp.o.d"
+  "libstr-c++.a"
+  "libstr-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/str_ConvertTest.dir/tests/ConvertTest.cpp.o"
+  "CMakeFiles/str_ConvertTest.dir/tests/ConvertTest.cpp.o.d"
+  "ConvertTest"
+  "ConvertTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_ConvertTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
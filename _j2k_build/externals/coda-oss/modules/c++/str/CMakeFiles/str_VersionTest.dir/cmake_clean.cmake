@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/str_VersionTest.dir/tests/VersionTest.cpp.o"
+  "CMakeFiles/str_VersionTest.dir/tests/VersionTest.cpp.o.d"
+  "VersionTest"
+  "VersionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_VersionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/str_test_base_convert.dir/unittests/test_base_convert.cpp.o"
+  "CMakeFiles/str_test_base_convert.dir/unittests/test_base_convert.cpp.o.d"
+  "test_base_convert"
+  "test_base_convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_test_base_convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
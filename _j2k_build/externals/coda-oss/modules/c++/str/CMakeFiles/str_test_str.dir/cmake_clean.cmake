@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/str_test_str.dir/unittests/test_str.cpp.o"
+  "CMakeFiles/str_test_str.dir/unittests/test_str.cpp.o.d"
+  "test_str"
+  "test_str.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/str_test_str.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
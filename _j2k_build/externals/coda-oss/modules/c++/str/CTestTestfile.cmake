@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/str
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/str
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(str_test_base_convert "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/test_base_convert")
+set_tests_properties(str_test_base_convert PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/str/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/str/CMakeLists.txt;0;")
+add_test(str_test_str "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/test_str")
+set_tests_properties(str_test_str PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/str/CMakeLists.txt;11;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/str/CMakeLists.txt;0;")
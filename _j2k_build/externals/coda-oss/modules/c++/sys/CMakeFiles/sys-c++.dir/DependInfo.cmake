@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/AbstractOS.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/AbstractOS.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/AbstractOS.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ConditionVarPosix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ConditionVarPosix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ConditionVarPosix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ConditionVarWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ConditionVarWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ConditionVarWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/Conf.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Conf.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Conf.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/DLLUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DLLUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DLLUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/DLLWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DLLWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DLLWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/DateTime.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DateTime.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DateTime.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/Dbg.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Dbg.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Dbg.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/DirectoryEntry.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DirectoryEntry.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/DirectoryEntry.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ErrUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ErrUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ErrUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ErrWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ErrWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ErrWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ExecUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ExecUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ExecUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ExecWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ExecWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ExecWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/File.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/File.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/File.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/FileFinder.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileFinder.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileFinder.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/FileUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/FileWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/FileWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/LocalDateTime.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/LocalDateTime.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/LocalDateTime.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/MutexCpp11.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexCpp11.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexCpp11.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/MutexPosix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexPosix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexPosix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/MutexWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/MutexWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/OSUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/OSUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/OSUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/OSWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/OSWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/OSWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/Path.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Path.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/Path.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ProcessUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ProcessUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ProcessUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ProcessWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ProcessWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ProcessWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ReadWriteMutex.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ReadWriteMutex.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ReadWriteMutex.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ResourceCheck.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ResourceCheck.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ResourceCheck.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ScopedCPUAffinityUnix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ScopedCPUAffinityUnix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ScopedCPUAffinityUnix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/SemaphorePosix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/SemaphorePosix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/SemaphorePosix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/SemaphoreWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/SemaphoreWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/SemaphoreWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/StopWatch.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/StopWatch.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/StopWatch.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ThreadPosix.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ThreadPosix.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ThreadPosix.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/ThreadWin32.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ThreadWin32.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/ThreadWin32.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/UTCDateTime.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/UTCDateTime.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/UTCDateTime.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/sys_Backtrace.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/sys_Backtrace.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/sys_Backtrace.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/sys/source/sys_filesystem.cpp" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/sys_filesystem.cpp.o" "gcc" "externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/source/sys_filesystem.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,83 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys-c++.dir/source/AbstractOS.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/AbstractOS.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ConditionVarPosix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ConditionVarPosix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ConditionVarWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ConditionVarWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/Conf.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/Conf.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/DLLUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/DLLUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/DLLWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/DLLWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/DateTime.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/DateTime.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/Dbg.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/Dbg.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/DirectoryEntry.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/DirectoryEntry.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ErrUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ErrUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ErrWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ErrWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ExecUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ExecUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ExecWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ExecWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/File.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/File.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/FileFinder.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/FileFinder.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/FileUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/FileUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/FileWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/FileWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/LocalDateTime.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/LocalDateTime.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/MutexCpp11.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/MutexCpp11.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/MutexPosix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/MutexPosix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/MutexWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/MutexWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/OSUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/OSUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/OSWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/OSWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/Path.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/Path.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ProcessUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ProcessUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ProcessWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ProcessWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ReadWriteMutex.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ReadWriteMutex.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ResourceCheck.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ResourceCheck.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ScopedCPUAffinityUnix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ScopedCPUAffinityUnix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/SemaphorePosix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/SemaphorePosix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/SemaphoreWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/SemaphoreWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/StopWatch.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/StopWatch.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ThreadPosix.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ThreadPosix.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/ThreadWin32.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/ThreadWin32.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/UTCDateTime.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/UTCDateTime.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/sys_Backtrace.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/sys_Backtrace.cpp.o.d"
+  "CMakeFiles/sys-c++.dir/source/sys_filesystem.cpp.o"
+  "CMakeFiles/sys-c++.dir/source/sys_filesystem.cpp.o.d"
+  "libsys-c++.a"
+  "libsys-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_CPUTest.dir/tests/CPUTest.cpp.o"
+  "CMakeFiles/sys_CPUTest.dir/tests/CPUTest.cpp.o.d"
+  "CPUTest"
+  "CPUTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_CPUTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_DLLTest.dir/tests/DLLTest.cpp.o"
+  "CMakeFiles/sys_DLLTest.dir/tests/DLLTest.cpp.o.d"
+  "DLLTest"
+  "DLLTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_DLLTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
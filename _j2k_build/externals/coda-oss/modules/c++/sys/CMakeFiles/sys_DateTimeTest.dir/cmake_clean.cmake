@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_DateTimeTest.dir/tests/DateTimeTest.cpp.o"
+  "CMakeFiles/sys_DateTimeTest.dir/tests/DateTimeTest.cpp.o.d"
+  "DateTimeTest"
+  "DateTimeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_DateTimeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_DirectoryTest.dir/tests/DirectoryTest.cpp.o"
+  "CMakeFiles/sys_DirectoryTest.dir/tests/DirectoryTest.cpp.o.d"
+  "DirectoryTest"
+  "DirectoryTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_DirectoryTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ErrTest.dir/tests/ErrTest.cpp.o"
+  "CMakeFiles/sys_ErrTest.dir/tests/ErrTest.cpp.o.d"
+  "ErrTest"
+  "ErrTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ErrTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ExecTest.dir/tests/ExecTest.cpp.o"
+  "CMakeFiles/sys_ExecTest.dir/tests/ExecTest.cpp.o.d"
+  "ExecTest"
+  "ExecTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ExecTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
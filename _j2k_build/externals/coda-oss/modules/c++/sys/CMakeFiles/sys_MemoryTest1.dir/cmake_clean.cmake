@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_MemoryTest1.dir/tests/MemoryTest1.cpp.o"
+  "CMakeFiles/sys_MemoryTest1.dir/tests/MemoryTest1.cpp.o.d"
+  "MemoryTest1"
+  "MemoryTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_MemoryTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
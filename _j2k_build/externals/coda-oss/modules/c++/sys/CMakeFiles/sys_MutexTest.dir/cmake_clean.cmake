@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_MutexTest.dir/tests/MutexTest.cpp.o"
+  "CMakeFiles/sys_MutexTest.dir/tests/MutexTest.cpp.o.d"
+  "MutexTest"
+  "MutexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_MutexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
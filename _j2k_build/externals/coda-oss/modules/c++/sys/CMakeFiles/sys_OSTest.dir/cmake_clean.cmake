@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_OSTest.dir/tests/OSTest.cpp.o"
+  "CMakeFiles/sys_OSTest.dir/tests/OSTest.cpp.o.d"
+  "OSTest"
+  "OSTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_OSTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
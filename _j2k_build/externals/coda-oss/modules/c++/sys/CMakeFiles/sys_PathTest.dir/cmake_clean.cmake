@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_PathTest.dir/tests/PathTest.cpp.o"
+  "CMakeFiles/sys_PathTest.dir/tests/PathTest.cpp.o.d"
+  "PathTest"
+  "PathTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_PathTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_RaiseTest.dir/tests/RaiseTest.cpp.o"
+  "CMakeFiles/sys_RaiseTest.dir/tests/RaiseTest.cpp.o.d"
+  "RaiseTest"
+  "RaiseTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_RaiseTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
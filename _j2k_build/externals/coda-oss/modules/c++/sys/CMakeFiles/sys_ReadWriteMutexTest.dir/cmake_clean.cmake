@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ReadWriteMutexTest.dir/tests/ReadWriteMutexTest.cpp.o"
+  "CMakeFiles/sys_ReadWriteMutexTest.dir/tests/ReadWriteMutexTest.cpp.o.d"
+  "ReadWriteMutexTest"
+  "ReadWriteMutexTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ReadWriteMutexTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ReentrantTest.dir/tests/ReentrantTest.cpp.o"
+  "CMakeFiles/sys_ReentrantTest.dir/tests/ReentrantTest.cpp.o.d"
+  "ReentrantTest"
+  "ReentrantTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ReentrantTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_TestBacktrace.dir/tests/TestBacktrace.cpp.o"
+  "CMakeFiles/sys_TestBacktrace.dir/tests/TestBacktrace.cpp.o.d"
+  "TestBacktrace"
+  "TestBacktrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_TestBacktrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ThreadFreeTest.dir/tests/ThreadFreeTest.cpp.o"
+  "CMakeFiles/sys_ThreadFreeTest.dir/tests/ThreadFreeTest.cpp.o.d"
+  "ThreadFreeTest"
+  "ThreadFreeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ThreadFreeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ThreadTest4.dir/tests/ThreadTest4.cpp.o"
+  "CMakeFiles/sys_ThreadTest4.dir/tests/ThreadTest4.cpp.o.d"
+  "ThreadTest4"
+  "ThreadTest4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ThreadTest4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_ThreadTest5.dir/tests/ThreadTest5.cpp.o"
+  "CMakeFiles/sys_ThreadTest5.dir/tests/ThreadTest5.cpp.o.d"
+  "ThreadTest5"
+  "ThreadTest5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_ThreadTest5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
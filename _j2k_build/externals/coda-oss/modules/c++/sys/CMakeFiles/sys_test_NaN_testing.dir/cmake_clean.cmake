@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_NaN_testing.dir/unittests/test_NaN_testing.cpp.o"
+  "CMakeFiles/sys_test_NaN_testing.dir/unittests/test_NaN_testing.cpp.o.d"
+  "test_NaN_testing"
+  "test_NaN_testing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_NaN_testing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_aligned_alloc.dir/unittests/test_aligned_alloc.cpp.o"
+  "CMakeFiles/sys_test_aligned_alloc.dir/unittests/test_aligned_alloc.cpp.o.d"
+  "test_aligned_alloc"
+  "test_aligned_alloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_aligned_alloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_atomic_counter.dir/unittests/test_atomic_counter.cpp.o"
+  "CMakeFiles/sys_test_atomic_counter.dir/unittests/test_atomic_counter.cpp.o.d"
+  "test_atomic_counter"
+  "test_atomic_counter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_atomic_counter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_byte_swap.dir/unittests/test_byte_swap.cpp.o"
+  "CMakeFiles/sys_test_byte_swap.dir/unittests/test_byte_swap.cpp.o.d"
+  "test_byte_swap"
+  "test_byte_swap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_byte_swap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
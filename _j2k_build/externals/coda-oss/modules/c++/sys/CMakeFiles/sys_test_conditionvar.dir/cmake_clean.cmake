@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_conditionvar.dir/unittests/test_conditionvar.cpp.o"
+  "CMakeFiles/sys_test_conditionvar.dir/unittests/test_conditionvar.cpp.o.d"
+  "test_conditionvar"
+  "test_conditionvar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_conditionvar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_datetime.dir/unittests/test_datetime.cpp.o"
+  "CMakeFiles/sys_test_datetime.dir/unittests/test_datetime.cpp.o.d"
+  "test_datetime"
+  "test_datetime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_datetime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
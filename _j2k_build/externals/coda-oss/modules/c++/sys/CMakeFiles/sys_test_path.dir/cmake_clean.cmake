@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_path.dir/unittests/test_path.cpp.o"
+  "CMakeFiles/sys_test_path.dir/unittests/test_path.cpp.o.d"
+  "test_path"
+  "test_path.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_path.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
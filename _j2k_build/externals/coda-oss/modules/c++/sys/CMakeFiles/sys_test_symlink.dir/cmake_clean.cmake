@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sys_test_symlink.dir/tests/test_symlink.cpp.o"
+  "CMakeFiles/sys_test_symlink.dir/tests/test_symlink.cpp.o.d"
+  "test_symlink"
+  "test_symlink.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sys_test_symlink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
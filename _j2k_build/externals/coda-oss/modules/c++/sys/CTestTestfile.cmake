@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/sys
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/sys
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(sys_test_NaN_testing "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_NaN_testing")
+set_tests_properties(sys_test_NaN_testing PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_aligned_alloc "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_aligned_alloc")
+set_tests_properties(sys_test_aligned_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_atomic_counter "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_atomic_counter")
+set_tests_properties(sys_test_atomic_counter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_byte_swap "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_byte_swap")
+set_tests_properties(sys_test_byte_swap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_conditionvar "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_conditionvar")
+set_tests_properties(sys_test_conditionvar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_datetime "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_datetime")
+set_tests_properties(sys_test_datetime PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_os "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_os")
+set_tests_properties(sys_test_os PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
+add_test(sys_test_path "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/test_path")
+set_tests_properties(sys_test_path PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;14;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/sys/CMakeLists.txt;0;")
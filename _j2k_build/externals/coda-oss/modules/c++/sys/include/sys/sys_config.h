@@ -0,0 +1,16 @@
+#ifndef _sys_CONFIG_H_
+#define _sys_CONFIG_H_
+
+/* #undef HAVE_PTHREAD_H */
+/* #undef HAVE_EXECINFO_H */
+/* #undef HAVE_CLOCK_GETTIME */
+/* #undef HAVE_ATOMIC_H */
+/* #undef HAVE_SYS_TIME_H */
+/* #undef HAVE_LOCALTIME_R */
+/* #undef HAVE_GMTIME_R */
+/* #undef HAVE_SETENV */
+/* #undef HAVE_POSIX_MEMALIGN */
+/* #undef HAVE_MEMALIGN */
+/* #undef SIZEOF_SIZE_T */
+
+#endif /* _sys_CONFIG_H_ */
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/Common.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Common.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Common.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/Header.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Header.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Header.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/IFD.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/IFD.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/IFD.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/IFDEntry.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/IFDEntry.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/IFDEntry.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/ImageReader.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/ImageReader.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/ImageReader.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/ImageWriter.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/ImageWriter.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/ImageWriter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/KnownTags.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/KnownTags.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/KnownTags.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/TiffFileReader.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TiffFileReader.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TiffFileReader.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/TiffFileWriter.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TiffFileWriter.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TiffFileWriter.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/TypeFactory.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TypeFactory.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/TypeFactory.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/tiff/source/Utils.cpp" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Utils.cpp.o" "gcc" "externals/coda-oss/modules/c++/tiff/CMakeFiles/tiff-c++.dir/source/Utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mt/CMakeFiles/mt-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/io/CMakeFiles/io-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/math/CMakeFiles/math-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/mem/CMakeFiles/mem-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/sys/CMakeFiles/sys-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/str/CMakeFiles/str-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/except/CMakeFiles/except-c++.dir/DependInfo.cmake"
+  "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
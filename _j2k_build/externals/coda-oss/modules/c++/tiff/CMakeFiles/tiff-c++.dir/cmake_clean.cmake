@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiff-c++.dir/source/Common.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/Common.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/Header.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/Header.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/IFD.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/IFD.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/IFDEntry.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/IFDEntry.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/ImageReader.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/ImageReader.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/ImageWriter.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/ImageWriter.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/KnownTags.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/KnownTags.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/TiffFileReader.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/TiffFileReader.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/TiffFileWriter.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/TiffFileWriter.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/TypeFactory.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/TypeFactory.cpp.o.d"
+  "CMakeFiles/tiff-c++.dir/source/Utils.cpp.o"
+  "CMakeFiles/tiff-c++.dir/source/Utils.cpp.o.d"
+  "libtiff-c++.a"
+  "libtiff-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiff-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
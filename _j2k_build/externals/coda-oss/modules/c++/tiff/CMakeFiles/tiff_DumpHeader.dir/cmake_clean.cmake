@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiff_DumpHeader.dir/tests/DumpHeader.cpp.o"
+  "CMakeFiles/tiff_DumpHeader.dir/tests/DumpHeader.cpp.o.d"
+  "DumpHeader"
+  "DumpHeader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiff_DumpHeader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
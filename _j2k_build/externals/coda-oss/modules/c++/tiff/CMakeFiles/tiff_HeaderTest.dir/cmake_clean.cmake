@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiff_HeaderTest.dir/tests/HeaderTest.cpp.o"
+  "CMakeFiles/tiff_HeaderTest.dir/tests/HeaderTest.cpp.o.d"
+  "HeaderTest"
+  "HeaderTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiff_HeaderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/c++/types/source/Range.cpp" "externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/source/Range.cpp.o" "gcc" "externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/source/Range.cpp.o.d"
+  "/root/repo/externals/coda-oss/modules/c++/types/source/RangeList.cpp" "externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/source/RangeList.cpp.o" "gcc" "externals/coda-oss/modules/c++/types/CMakeFiles/types-c++.dir/source/RangeList.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
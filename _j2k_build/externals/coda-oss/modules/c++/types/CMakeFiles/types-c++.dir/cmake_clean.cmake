@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types-c++.dir/source/Range.cpp.o"
+  "CMakeFiles/types-c++.dir/source/Range.cpp.o.d"
+  "CMakeFiles/types-c++.dir/source/RangeList.cpp.o"
+  "CMakeFiles/types-c++.dir/source/RangeList.cpp.o.d"
+  "libtypes-c++.a"
+  "libtypes-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test_complex.dir/unittests/test_complex.cpp.o"
+  "CMakeFiles/types_test_complex.dir/unittests/test_complex.cpp.o.d"
+  "test_complex"
+  "test_complex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test_complex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
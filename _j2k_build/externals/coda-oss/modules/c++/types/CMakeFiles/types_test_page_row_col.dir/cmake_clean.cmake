@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test_page_row_col.dir/unittests/test_page_row_col.cpp.o"
+  "CMakeFiles/types_test_page_row_col.dir/unittests/test_page_row_col.cpp.o.d"
+  "test_page_row_col"
+  "test_page_row_col.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test_page_row_col.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
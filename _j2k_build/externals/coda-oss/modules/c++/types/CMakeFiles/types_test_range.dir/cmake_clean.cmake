@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test_range.dir/unittests/test_range.cpp.o"
+  "CMakeFiles/types_test_range.dir/unittests/test_range.cpp.o.d"
+  "test_range"
+  "test_range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
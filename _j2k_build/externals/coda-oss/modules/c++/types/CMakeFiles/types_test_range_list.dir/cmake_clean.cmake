@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/types_test_range_list.dir/unittests/test_range_list.cpp.o"
+  "CMakeFiles/types_test_range_list.dir/unittests/test_range_list.cpp.o.d"
+  "test_range_list"
+  "test_range_list.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/types_test_range_list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/types
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/types
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(types_test_complex "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/test_complex")
+set_tests_properties(types_test_complex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;7;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;0;")
+add_test(types_test_page_row_col "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/test_page_row_col")
+set_tests_properties(types_test_page_row_col PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;7;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;0;")
+add_test(types_test_range "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/test_range")
+set_tests_properties(types_test_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;7;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;0;")
+add_test(types_test_range_list "/root/repo/_j2k_build/externals/coda-oss/modules/c++/types/test_range_list")
+set_tests_properties(types_test_range_list PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;7;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/types/CMakeLists.txt;0;")
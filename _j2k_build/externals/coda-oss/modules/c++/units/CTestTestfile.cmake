@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/c++/units
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/c++/units
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(units_test_units "/root/repo/_j2k_build/externals/coda-oss/modules/c++/units/test_units")
+set_tests_properties(units_test_units PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/externals/coda-oss/cmake/CodaBuild.cmake;433;add_test;/root/repo/externals/coda-oss/modules/c++/units/CMakeLists.txt;7;coda_add_tests;/root/repo/externals/coda-oss/modules/c++/units/CMakeLists.txt;0;")
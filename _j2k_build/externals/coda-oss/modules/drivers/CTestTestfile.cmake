@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/externals/coda-oss/modules/drivers
+# Build directory: /root/repo/_j2k_build/externals/coda-oss/modules/drivers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("j2k")
+subdirs("jars")
+subdirs("jpeg")
+subdirs("pcre")
+subdirs("hdf5")
+subdirs("highfive")
@@ -0,0 +1,363 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5A.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5A.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5A.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5AC.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5AC.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5AC.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ACdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ACmpio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACmpio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACmpio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ACproxy_entry.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACproxy_entry.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ACproxy_entry.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Abtree2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Abtree2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Abtree2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Adense.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Adense.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Adense.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Adeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Adeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Adeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Aint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Aint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Aint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Atest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Atest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Atest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2cache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2cache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2cache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2dbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2dbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2dbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2hdr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2hdr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2hdr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2int.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2int.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2int.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2internal.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2internal.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2internal.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2leaf.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2leaf.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2leaf.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2stat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2stat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2stat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5B2test.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2test.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5B2test.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Bcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Bcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Bcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Bdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Bdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Bdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5C.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5C.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5C.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5CS.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5CS.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5CS.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5CX.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5CX.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5CX.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Centry.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Centry.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Centry.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cepoch.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cepoch.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cepoch.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cimage.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cimage.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cimage.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Clog.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Clog_json.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog_json.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog_json.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Clog_trace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog_trace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Clog_trace.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cmpio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cmpio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cmpio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cprefetched.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cprefetched.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cprefetched.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Cquery.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cquery.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Cquery.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ctag.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ctag.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ctag.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ctest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ctest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ctest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5D.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5D.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5D.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dbtree.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dbtree.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dbtree.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dbtree2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dbtree2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dbtree2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dchunk.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dchunk.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dchunk.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dcompact.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dcompact.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dcompact.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dcontig.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dcontig.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dcontig.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ddbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ddbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ddbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ddeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ddeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ddeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dearray.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dearray.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dearray.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Defl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Defl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Defl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dfarray.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dfarray.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dfarray.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dfill.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dfill.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dfill.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dlayout.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dlayout.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dlayout.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dmpio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dmpio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dmpio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dnone.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dnone.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dnone.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Doh.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Doh.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Doh.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dscatgath.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dscatgath.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dscatgath.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dselect.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dselect.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dselect.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dsingle.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dsingle.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dsingle.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Dvirtual.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dvirtual.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Dvirtual.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5E.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5E.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5E.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EA.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EA.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EA.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAdblkpage.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdblkpage.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdblkpage.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAdblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAdblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAhdr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAhdr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAhdr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAiblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAiblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAiblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAsblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAsblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAsblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAstat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAstat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAstat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5EAtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5EAtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ES.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ES.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ES.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ESevent.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESevent.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESevent.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ESint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5ESlist.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESlist.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5ESlist.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Edeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Edeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Edeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Eint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Eint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Eint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5F.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5F.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5F.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FA.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FA.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FA.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAdblkpage.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdblkpage.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdblkpage.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAdblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAdblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAhdr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAhdr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAhdr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAstat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAstat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAstat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FAtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FAtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FD.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FD.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FD.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDcore.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDcore.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDcore.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDdirect.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDdirect.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDdirect.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDfamily.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDfamily.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDfamily.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDhdfs.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDhdfs.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDhdfs.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDlog.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDlog.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDlog.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDmirror.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmirror.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmirror.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDmpi.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmpi.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmpi.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDmpio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmpio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmpio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDmulti.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmulti.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDmulti.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDonion.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDonion_header.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_header.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_header.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDonion_history.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_history.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_history.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDonion_index.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_index.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDonion_index.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDperform.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDperform.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDperform.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDros3.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDros3.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDros3.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDs3comms.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDs3comms.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDs3comms.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDsec2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDsec2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDsec2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDspace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDspace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDspace.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDsplitter.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDsplitter.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDsplitter.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDstdio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDstdio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDstdio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FDwindows.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDwindows.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FDwindows.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FL.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FL.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FL.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FO.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FO.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FO.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FS.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FS.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FS.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FScache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FScache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FScache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FSdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FSint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FSsection.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSsection.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSsection.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FSstat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSstat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FSstat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5FStest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FStest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5FStest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Faccum.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Faccum.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Faccum.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fcwfs.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fcwfs.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fcwfs.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fefc.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fefc.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fefc.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ffake.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ffake.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ffake.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fmount.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fmount.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fmount.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fmpi.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fmpi.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fmpi.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fquery.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fquery.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fquery.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fsfile.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsfile.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsfile.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fspace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fspace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fspace.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fsuper.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsuper.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsuper.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Fsuper_cache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsuper_cache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Fsuper_cache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ftest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ftest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ftest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5G.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5G.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5G.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gbtree2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gbtree2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gbtree2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gcompact.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gcompact.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gcompact.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gdense.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gdense.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gdense.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gent.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gent.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gent.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Glink.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Glink.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Glink.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gloc.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gloc.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gloc.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gname.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gname.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gname.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gnode.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gnode.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gnode.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gobj.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gobj.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gobj.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Goh.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Goh.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Goh.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Groot.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Groot.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Groot.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gstab.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gstab.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gstab.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Gtraverse.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gtraverse.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Gtraverse.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HF.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HF.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HF.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFbtree2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFbtree2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFbtree2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFdblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFdtable.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdtable.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFdtable.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFhdr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFhdr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFhdr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFhuge.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFhuge.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFhuge.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFiblock.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFiblock.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFiblock.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFiter.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFiter.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFiter.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFman.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFman.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFman.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFsection.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFsection.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFsection.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFspace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFspace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFspace.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFstat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFstat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFstat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HFtiny.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFtiny.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HFtiny.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HG.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HG.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HG.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HGcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HGdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HGquery.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGquery.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HGquery.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HL.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HL.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HL.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HLcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HLdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HLdblk.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLdblk.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLdblk.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HLint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5HLprfx.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLprfx.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5HLprfx.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5I.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5I.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5I.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Idbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Idbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Idbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Iint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Iint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Iint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Itest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Itest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Itest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5L.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5L.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5L.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5LT.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LT.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LT.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5LTanalyze.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LTanalyze.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LTanalyze.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5LTparse.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LTparse.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5LTparse.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ldeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ldeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ldeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Lexternal.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Lexternal.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Lexternal.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Lint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Lint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Lint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5M.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5M.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5M.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5MF.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MF.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MF.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5MFaggr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFaggr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFaggr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5MFdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5MFsection.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFsection.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MFsection.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5MM.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MM.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5MM.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5O.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5O.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5O.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oainfo.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oainfo.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oainfo.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oalloc.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oalloc.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oalloc.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oattr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oattr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oattr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oattribute.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oattribute.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oattribute.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Obogus.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Obogus.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Obogus.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Obtreek.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Obtreek.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Obtreek.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ocache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ocache_image.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocache_image.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocache_image.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ochunk.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ochunk.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ochunk.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ocont.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocont.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocont.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ocopy.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocopy.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocopy.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ocopy_ref.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocopy_ref.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ocopy_ref.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Odbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Odeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Odrvinfo.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odrvinfo.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odrvinfo.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Odtype.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odtype.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Odtype.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oefl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oefl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oefl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ofill.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ofill.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ofill.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oflush.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oflush.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oflush.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ofsinfo.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ofsinfo.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ofsinfo.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oginfo.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oginfo.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oginfo.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Olayout.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olayout.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olayout.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Olinfo.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olinfo.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olinfo.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Olink.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olink.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Olink.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Omessage.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Omessage.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Omessage.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Omtime.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Omtime.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Omtime.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oname.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oname.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oname.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Onull.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Onull.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Onull.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Opline.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Opline.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Opline.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Orefcount.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Orefcount.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Orefcount.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Osdspace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Osdspace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Osdspace.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oshared.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oshared.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oshared.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Oshmesg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oshmesg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Oshmesg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ostab.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ostab.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ostab.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Otest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Otest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Otest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ounknown.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ounknown.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ounknown.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5P.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5P.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5P.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5PB.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PB.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PB.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5PL.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PL.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PL.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5PLint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5PLpath.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLpath.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLpath.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5PLplugin_cache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLplugin_cache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5PLplugin_cache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pacpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pacpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pacpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pdapl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdapl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdapl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pdcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pdxpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdxpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pdxpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pencdec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pencdec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pencdec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pfapl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfapl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfapl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pfcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pfmpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfmpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pfmpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pgcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pgcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pgcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Plapl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Plapl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Plapl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Plcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Plcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Plcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pmapl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pmapl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pmapl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pmcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pmcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pmcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pocpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pocpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pocpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pocpypl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pocpypl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pocpypl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Pstrcpl.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pstrcpl.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Pstrcpl.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ptest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ptest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ptest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5R.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5R.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5R.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5RS.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5RS.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5RS.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Rdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Rdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Rdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Rint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Rint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Rint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5S.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5S.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5S.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SL.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SL.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SL.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SM.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SM.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SM.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SMbtree2.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMbtree2.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMbtree2.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SMcache.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMcache.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMcache.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SMmessage.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMmessage.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMmessage.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5SMtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5SMtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Sall.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sall.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sall.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Sdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Sdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Shyper.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Shyper.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Shyper.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Smpio.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Smpio.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Smpio.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Snone.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Snone.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Snone.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Spoint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Spoint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Spoint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Sselect.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sselect.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Sselect.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Stest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Stest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Stest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5T.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5T.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5T.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5TS.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5TS.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5TS.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tarray.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tarray.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tarray.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tbit.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tbit.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tbit.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tcommit.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcommit.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcommit.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tcompound.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcompound.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcompound.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tconv.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tconv.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tconv.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tcset.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcset.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tcset.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tdbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tdbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tdbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tdeprec.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tdeprec.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tdeprec.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tenum.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tenum.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tenum.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tfields.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfields.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfields.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tfixed.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfixed.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfixed.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tfloat.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfloat.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tfloat.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tinit.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tinit.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tinit.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tnative.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tnative.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tnative.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Toffset.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Toffset.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Toffset.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Toh.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Toh.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Toh.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Topaque.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Topaque.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Topaque.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Torder.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Torder.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Torder.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tpad.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tpad.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tpad.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tprecis.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tprecis.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tprecis.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tref.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tref.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tref.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tstrpad.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tstrpad.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tstrpad.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tvisit.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tvisit.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tvisit.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Tvlen.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tvlen.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Tvlen.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5UC.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5UC.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5UC.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VL.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VL.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VL.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLcallback.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLcallback.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLcallback.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLdyn_ops.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLdyn_ops.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLdyn_ops.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLint.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLint.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLint.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_attr.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_attr.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_attr.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_blob.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_blob.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_blob.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_dataset.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_dataset.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_dataset.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_datatype.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_datatype.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_datatype.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_file.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_file.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_file.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_group.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_group.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_group.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_introspect.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_introspect.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_introspect.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_link.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_link.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_link.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_object.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_object.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_object.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLnative_token.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_token.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLnative_token.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLpassthru.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLpassthru.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLpassthru.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VLtest.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLtest.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VLtest.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5VM.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VM.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5VM.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5WB.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5WB.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5WB.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Z.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Z.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Z.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Zdeflate.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zdeflate.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zdeflate.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Zfletcher32.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zfletcher32.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zfletcher32.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Znbit.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Znbit.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Znbit.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Zscaleoffset.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zscaleoffset.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zscaleoffset.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Zshuffle.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zshuffle.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zshuffle.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Zszip.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zszip.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Zszip.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5Ztrans.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ztrans.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5Ztrans.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5checksum.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5checksum.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5checksum.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5dbg.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5dbg.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5dbg.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5detect.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5detect.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5detect.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5lib_settings.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5lib_settings.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5lib_settings.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5mpi.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5mpi.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5mpi.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5system.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5system.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5system.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5timer.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5timer.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5timer.c.o.d"
+  "/root/repo/externals/coda-oss/modules/drivers/hdf5/source/H5trace.c" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5trace.c.o" "gcc" "externals/coda-oss/modules/drivers/hdf5/CMakeFiles/hdf5-c++.dir/source/H5trace.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
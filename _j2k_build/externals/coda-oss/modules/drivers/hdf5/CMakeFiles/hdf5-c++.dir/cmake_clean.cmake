@@ -0,0 +1,699 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hdf5-c++.dir/source/H5.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5A.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5A.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5AC.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5AC.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACmpio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACmpio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACproxy_entry.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ACproxy_entry.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Abtree2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Abtree2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Adense.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Adense.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Adeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Adeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Aint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Aint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Atest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Atest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2cache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2cache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2dbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2dbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2hdr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2hdr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2int.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2int.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2internal.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2internal.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2leaf.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2leaf.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2stat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2stat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2test.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5B2test.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Bcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Bcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Bdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Bdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5C.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5C.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5CS.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5CS.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5CX.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5CX.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Centry.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Centry.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cepoch.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cepoch.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cimage.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cimage.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog_json.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog_json.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog_trace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Clog_trace.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cmpio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cmpio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cprefetched.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cprefetched.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cquery.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Cquery.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ctag.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ctag.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ctest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ctest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5D.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5D.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dbtree.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dbtree.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dbtree2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dbtree2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dchunk.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dchunk.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dcompact.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dcompact.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dcontig.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dcontig.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ddbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ddbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ddeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ddeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dearray.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dearray.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Defl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Defl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dfarray.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dfarray.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dfill.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dfill.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dlayout.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dlayout.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dmpio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dmpio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dnone.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dnone.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Doh.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Doh.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dscatgath.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dscatgath.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dselect.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dselect.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dsingle.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dsingle.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dvirtual.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Dvirtual.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5E.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5E.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EA.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EA.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdblkpage.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdblkpage.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAdblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAhdr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAhdr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAiblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAiblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAsblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAsblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAstat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAstat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5EAtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ES.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ES.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESevent.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESevent.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESlist.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5ESlist.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Edeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Edeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Eint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Eint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5F.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5F.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FA.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FA.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdblkpage.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdblkpage.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAdblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAhdr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAhdr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAstat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAstat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FAtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FD.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FD.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDcore.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDcore.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDdirect.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDdirect.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDfamily.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDfamily.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDhdfs.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDhdfs.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDlog.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDlog.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmirror.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmirror.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmpi.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmpi.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmpio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmpio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmulti.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDmulti.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_header.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_header.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_history.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_history.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_index.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDonion_index.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDperform.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDperform.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDros3.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDros3.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDs3comms.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDs3comms.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDsec2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDsec2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDspace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDspace.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDsplitter.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDsplitter.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDstdio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDstdio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDwindows.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FDwindows.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FL.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FL.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FO.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FO.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FS.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FS.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FScache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FScache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSsection.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSsection.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSstat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FSstat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5FStest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5FStest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Faccum.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Faccum.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fcwfs.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fcwfs.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fefc.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fefc.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ffake.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ffake.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fmount.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fmount.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fmpi.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fmpi.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fquery.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fquery.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsfile.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsfile.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fspace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fspace.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsuper.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsuper.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsuper_cache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Fsuper_cache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ftest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ftest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5G.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5G.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gbtree2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gbtree2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gcompact.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gcompact.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gdense.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gdense.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gent.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gent.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Glink.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Glink.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gloc.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gloc.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gname.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gname.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gnode.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gnode.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gobj.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gobj.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Goh.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Goh.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Groot.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Groot.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gstab.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gstab.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gtraverse.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Gtraverse.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HF.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HF.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFbtree2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFbtree2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdtable.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFdtable.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFhdr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFhdr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFhuge.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFhuge.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFiblock.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFiblock.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFiter.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFiter.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFman.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFman.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFsection.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFsection.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFspace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFspace.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFstat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFstat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFtiny.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HFtiny.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HG.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HG.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGquery.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HGquery.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HL.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HL.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLdblk.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLdblk.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLprfx.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5HLprfx.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5I.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5I.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Idbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Idbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Iint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Iint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Itest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Itest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5L.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5L.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5LT.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5LT.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5LTanalyze.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5LTanalyze.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5LTparse.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5LTparse.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ldeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ldeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Lexternal.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Lexternal.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Lint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Lint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5M.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5M.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5MF.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5MF.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFaggr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFaggr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFsection.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5MFsection.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5MM.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5MM.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5O.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5O.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oainfo.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oainfo.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oalloc.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oalloc.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oattr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oattr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oattribute.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oattribute.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Obogus.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Obogus.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Obtreek.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Obtreek.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocache_image.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocache_image.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ochunk.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ochunk.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocont.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocont.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocopy.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocopy.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocopy_ref.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ocopy_ref.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odrvinfo.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odrvinfo.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odtype.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Odtype.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oefl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oefl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ofill.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ofill.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oflush.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oflush.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ofsinfo.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ofsinfo.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oginfo.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oginfo.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olayout.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olayout.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olinfo.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olinfo.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olink.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Olink.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Omessage.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Omessage.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Omtime.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Omtime.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oname.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oname.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Onull.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Onull.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Opline.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Opline.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Orefcount.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Orefcount.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Osdspace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Osdspace.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oshared.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oshared.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oshmesg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Oshmesg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ostab.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ostab.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Otest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Otest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ounknown.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ounknown.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5P.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5P.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5PB.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5PB.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5PL.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5PL.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLpath.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLpath.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLplugin_cache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5PLplugin_cache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pacpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pacpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdapl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdapl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdxpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pdxpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pencdec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pencdec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfapl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfapl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfmpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pfmpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pgcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pgcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Plapl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Plapl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Plcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Plcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pmapl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pmapl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pmcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pmcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pocpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pocpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pocpypl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pocpypl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pstrcpl.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Pstrcpl.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ptest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ptest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5R.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5R.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5RS.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5RS.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Rdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Rdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Rint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Rint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5S.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5S.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SL.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SL.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SM.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SM.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMbtree2.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMbtree2.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMcache.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMcache.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMmessage.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMmessage.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5SMtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sall.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sall.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Shyper.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Shyper.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Smpio.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Smpio.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Snone.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Snone.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Spoint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Spoint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sselect.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Sselect.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Stest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Stest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5T.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5T.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5TS.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5TS.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tarray.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tarray.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tbit.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tbit.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcommit.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcommit.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcompound.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcompound.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tconv.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tconv.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcset.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tcset.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tdbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tdbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tdeprec.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tdeprec.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tenum.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tenum.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfields.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfields.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfixed.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfixed.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfloat.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tfloat.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tinit.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tinit.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tnative.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tnative.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Toffset.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Toffset.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Toh.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Toh.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Topaque.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Topaque.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Torder.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Torder.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tpad.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tpad.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tprecis.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tprecis.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tref.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tref.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tstrpad.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tstrpad.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tvisit.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tvisit.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tvlen.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Tvlen.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5UC.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5UC.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VL.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VL.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLcallback.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLcallback.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLdyn_ops.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLdyn_ops.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLint.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLint.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_attr.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_attr.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_blob.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_blob.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_dataset.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_dataset.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_datatype.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_datatype.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_file.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_file.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_group.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_group.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_introspect.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_introspect.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_link.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_link.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_object.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_object.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_token.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLnative_token.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLpassthru.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLpassthru.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLtest.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VLtest.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5VM.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5VM.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5WB.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5WB.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Z.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Z.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zdeflate.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zdeflate.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zfletcher32.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zfletcher32.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Znbit.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Znbit.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zscaleoffset.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zscaleoffset.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zshuffle.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zshuffle.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zszip.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Zszip.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ztrans.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5Ztrans.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5checksum.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5checksum.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5dbg.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5dbg.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5detect.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5detect.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5lib_settings.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5lib_settings.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5mpi.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5mpi.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5system.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5system.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5timer.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5timer.c.o.d"
+  "CMakeFiles/hdf5-c++.dir/source/H5trace.c.o"
+  "CMakeFiles/hdf5-c++.dir/source/H5trace.c.o.d"
+  "libhdf5-c++.a"
+  "libhdf5-c++.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/hdf5-c++.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()